@@ -9,19 +9,35 @@
 // language; other languages get their own native oracle (Python `ast`, the TS
 // compiler API, …) or tree-sitter as a second tier.
 //
-// Usage: astoracle <dir>   (defaults to ".")
+// Files are verified in parallel with the same worker-count semantics as
+// DirProcessor (--workers 0 = one per CPU core), and --cache persists parse
+// results keyed by file checksum so an incremental oracle run costs roughly
+// the changed files.
+//
+// Usage: astoracle [--workers N] [--cache] <dir>   (dir defaults to ".")
 package main
 
 import (
 	"encoding/json"
+	"fmt"
 	"go/ast"
 	"go/parser"
 	"go/token"
 	"os"
 	"path/filepath"
+	"runtime"
+	"sort"
+	"strconv"
 	"strings"
+	"sync"
+
+	"github.com/ruslano69/funcfinder/internal"
 )
 
+// oracleCacheFile is the default location of the parse cache, alongside
+// funcfinder's .funcfinder-cache.
+const oracleCacheFile = ".astoracle-cache"
+
 type sym struct {
 	Name string `json:"name"`
 	Line int    `json:"line"`
@@ -43,13 +59,116 @@ type out struct {
 	Unparseable int `json:"unparseable"`
 }
 
+// cacheEntry is one file's parse result keyed by checksum. Unparseable is
+// cached too, so warm runs keep the Unparseable count honest.
+type cacheEntry struct {
+	Checksum    string `json:"checksum"`
+	Functions   []sym  `json:"functions,omitempty"`
+	Classes     []sym  `json:"classes,omitempty"`
+	Unparseable bool   `json:"unparseable,omitempty"`
+}
+
 func main() {
 	root := "."
-	if len(os.Args) > 1 {
-		root = os.Args[1]
+	workers := 0
+	useCache := false
+
+	for i := 1; i < len(os.Args); i++ {
+		arg := os.Args[i]
+		switch {
+		case arg == "--workers" && i+1 < len(os.Args):
+			n, err := strconv.Atoi(os.Args[i+1])
+			if err != nil {
+				internal.FatalError("invalid --workers value: %s", os.Args[i+1])
+			}
+			workers = n
+			i++
+		case arg == "--cache":
+			useCache = true
+		case arg == "-h" || arg == "--help":
+			fmt.Println("Usage: astoracle [--workers N] [--cache] <dir>")
+			return
+		case !strings.HasPrefix(arg, "-"):
+			root = arg
+		}
+	}
+	// Same semantics as DirProcessor: 0 or negative means one per core.
+	if workers <= 0 {
+		workers = runtime.NumCPU()
+	}
+
+	paths := collectGoFiles(root)
+
+	cache := map[string]cacheEntry{}
+	if useCache {
+		if data, err := os.ReadFile(oracleCacheFile); err == nil {
+			// A corrupt cache is silently dropped and rebuilt below.
+			json.Unmarshal(data, &cache) //nolint:errcheck
+		}
 	}
 
+	entries := make([]cacheEntry, len(paths))
+	var wg sync.WaitGroup
+	jobs := make(chan int)
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for i := range jobs {
+				entries[i] = parseCached(paths[i], cache, useCache)
+			}
+		}()
+	}
+	for i := range paths {
+		jobs <- i
+	}
+	close(jobs)
+	wg.Wait()
+
 	var o out
+	newCache := make(map[string]cacheEntry, len(paths))
+	for i, path := range paths {
+		e := entries[i]
+		newCache[path] = e
+		if e.Unparseable {
+			o.Unparseable++
+			continue
+		}
+		if len(e.Functions) == 0 && len(e.Classes) == 0 {
+			continue
+		}
+		fo := fileOut{Path: path, Functions: e.Functions, Classes: e.Classes}
+		if fo.Functions == nil {
+			fo.Functions = []sym{}
+		}
+		if fo.Classes == nil {
+			fo.Classes = []sym{}
+		}
+		o.Files = append(o.Files, fo)
+		o.TotalFiles++
+		o.TotalFunctions += len(fo.Functions)
+		o.TotalClasses += len(fo.Classes)
+	}
+
+	if useCache {
+		// Entries for deleted files fall out naturally: newCache only holds
+		// the paths seen this run.
+		if data, err := json.Marshal(newCache); err == nil {
+			if err := os.WriteFile(oracleCacheFile, data, 0644); err != nil {
+				internal.WarnError("saving oracle cache: %v", err)
+			}
+		}
+	}
+
+	enc := json.NewEncoder(os.Stdout)
+	enc.SetIndent("", "  ")
+	_ = enc.Encode(o)
+}
+
+// collectGoFiles walks root and returns every .go file in deterministic
+// (sorted) order, mirroring funcfinder's traversal rules.
+func collectGoFiles(root string) []string {
+	var paths []string
 	_ = filepath.Walk(root, func(path string, info os.FileInfo, err error) error {
 		if err != nil {
 			return nil
@@ -65,53 +184,65 @@ func main() {
 			}
 			return nil
 		}
-		if !strings.HasSuffix(path, ".go") {
-			return nil
+		if strings.HasSuffix(path, ".go") {
+			paths = append(paths, path)
 		}
+		return nil
+	})
+	sort.Strings(paths)
+	return paths
+}
 
-		fset := token.NewFileSet()
-		f, perr := parser.ParseFile(fset, path, nil, parser.SkipObjectResolution)
-		if perr != nil {
-			o.Unparseable++
-			return nil
+// parseCached answers from the checksum-validated cache when possible and
+// parses with go/ast otherwise.
+func parseCached(path string, cache map[string]cacheEntry, useCache bool) cacheEntry {
+	checksum := ""
+	if useCache {
+		sum, err := internal.FileChecksum(path)
+		if err == nil {
+			checksum = sum
+			if e, ok := cache[path]; ok && e.Checksum == checksum {
+				return e
+			}
 		}
+	}
+	e := parseFile(path)
+	e.Checksum = checksum
+	return e
+}
+
+// parseFile extracts the ground-truth symbols from one file.
+func parseFile(path string) cacheEntry {
+	fset := token.NewFileSet()
+	f, perr := parser.ParseFile(fset, path, nil, parser.SkipObjectResolution)
+	if perr != nil {
+		return cacheEntry{Unparseable: true}
+	}
 
-		fo := fileOut{Path: path, Functions: []sym{}, Classes: []sym{}}
-		// Walk the whole tree, not just f.Decls: Go allows type declarations
-		// inside function bodies (`func f() { type T interface{...} }`), and
-		// funcfinder — being line-based — reports those. If the ruler only looked
-		// at top-level decls it would undercount and unfairly dent funcfinder's
-		// precision. Named functions are always top-level FuncDecls; anonymous
-		// func literals (FuncLit) carry no name, and funcfinder doesn't report
-		// them either, so we skip them too.
-		ast.Inspect(f, func(n ast.Node) bool {
-			switch d := n.(type) {
-			case *ast.FuncDecl:
-				// Both plain funcs and methods; name is the bare identifier, the
-				// way funcfinder reports it. Line is the `func` keyword.
-				fo.Functions = append(fo.Functions, sym{d.Name.Name, fset.Position(d.Pos()).Line})
-			case *ast.GenDecl:
-				if d.Tok == token.TYPE {
-					for _, spec := range d.Specs {
-						if ts, ok := spec.(*ast.TypeSpec); ok {
-							fo.Classes = append(fo.Classes, sym{ts.Name.Name, fset.Position(ts.Pos()).Line})
-						}
+	var e cacheEntry
+	// Walk the whole tree, not just f.Decls: Go allows type declarations
+	// inside function bodies (`func f() { type T interface{...} }`), and
+	// funcfinder — being line-based — reports those. If the ruler only looked
+	// at top-level decls it would undercount and unfairly dent funcfinder's
+	// precision. Named functions are always top-level FuncDecls; anonymous
+	// func literals (FuncLit) carry no name, and funcfinder doesn't report
+	// them either, so we skip them too.
+	ast.Inspect(f, func(n ast.Node) bool {
+		switch d := n.(type) {
+		case *ast.FuncDecl:
+			// Both plain funcs and methods; name is the bare identifier, the
+			// way funcfinder reports it. Line is the `func` keyword.
+			e.Functions = append(e.Functions, sym{d.Name.Name, fset.Position(d.Pos()).Line})
+		case *ast.GenDecl:
+			if d.Tok == token.TYPE {
+				for _, spec := range d.Specs {
+					if ts, ok := spec.(*ast.TypeSpec); ok {
+						e.Classes = append(e.Classes, sym{ts.Name.Name, fset.Position(ts.Pos()).Line})
 					}
 				}
 			}
-			return true
-		})
-
-		if len(fo.Functions) > 0 || len(fo.Classes) > 0 {
-			o.Files = append(o.Files, fo)
-			o.TotalFiles++
-			o.TotalFunctions += len(fo.Functions)
-			o.TotalClasses += len(fo.Classes)
 		}
-		return nil
+		return true
 	})
-
-	enc := json.NewEncoder(os.Stdout)
-	enc.SetIndent("", "  ")
-	_ = enc.Encode(o)
+	return e
 }
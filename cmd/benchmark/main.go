@@ -1,66 +1,190 @@
-
-
-
-
+// benchmark - Corpus-level throughput harness for the directory engine.
+//
+// The old version looped FindFunctions over one file, which said nothing
+// about directory-mode scaling, worker counts, or the sanitizer across
+// languages. This one runs DirProcessor over a pinned multi-language corpus
+// (seeded from test_examples/, replicated synthetically to a realistic size)
+// and reports MB/s and files/s per worker count with p50/p99 per-file
+// latency, as a JSON document on stdout for regression tracking.
+//
+// Usage:
+//
+//	benchmark [-corpus test_examples] [-scale 20] [-workers 1,2,4,8] [-mode all]
 package main
 
 import (
+	"encoding/json"
 	"flag"
 	"fmt"
 	"os"
-	"time"
+	"path/filepath"
+	"strconv"
+	"strings"
+
 	"github.com/ruslano69/funcfinder/internal"
 )
 
+type benchRow struct {
+	Workers        int     `json:"workers"`
+	Files          int64   `json:"files"`
+	Bytes          int64   `json:"bytes"`
+	WallSeconds    float64 `json:"wall_seconds"`
+	FilesPerSecond float64 `json:"files_per_second"`
+	MBPerSecond    float64 `json:"mb_per_second"`
+	P50FileMs      float64 `json:"p50_file_ms"`
+	P99FileMs      float64 `json:"p99_file_ms"`
+	SymbolsFound   int64   `json:"symbols_found"`
+}
+
+type benchReport struct {
+	CorpusSeed string     `json:"corpus_seed"`
+	Scale      int        `json:"scale"`
+	Mode       string     `json:"mode"`
+	Rows       []benchRow `json:"rows"`
+}
+
 func main() {
-	iterations := flag.Int("n", 1000, "Number of iterations")
+	corpusSeed := flag.String("corpus", "test_examples", "seed directory with one example per language")
+	scale := flag.Int("scale", 20, "number of synthetic replicas of the seed corpus")
+	workersList := flag.String("workers", "1,2,4,8", "comma-separated worker counts to measure")
+	mode := flag.String("mode", "all", "work mode passed to DirProcessor: functions, structs, or all")
 	flag.Parse()
 
-	if flag.NArg() < 2 {
-		fmt.Fprintf(os.Stderr, "Usage: benchmark -n <iterations> <file> <lang>\n")
-		os.Exit(1)
+	config, err := internal.LoadConfig()
+	if err != nil {
+		internal.FatalError("loading config: %v", err)
 	}
 
-	filename := flag.Arg(0)
-	lang := flag.Arg(1)
+	workerCounts, err := parseWorkerCounts(*workersList)
+	if err != nil {
+		internal.FatalError("parsing -workers: %v", err)
+	}
 
-	// Load config once
-	config, err := internal.LoadConfig()
+	corpusDir, err := buildCorpus(config, *corpusSeed, *scale)
 	if err != nil {
-		internal.FatalError("loading config: %v", err)
+		internal.FatalError("building corpus: %v", err)
+	}
+	defer os.RemoveAll(corpusDir) //nolint:errcheck
+
+	// Warm run: fills the page cache so the first measured row isn't
+	// penalized for cold reads the others don't pay.
+	warm := internal.NewDirProcessor(config, workerCounts[0], true, false, *mode)
+	if err := warm.ProcessDirectoryStream(corpusDir, func(internal.DirResult) {}); err != nil {
+		internal.FatalError("warm-up scan: %v", err)
+	}
+
+	report := benchReport{CorpusSeed: *corpusSeed, Scale: *scale, Mode: *mode}
+	for _, workers := range workerCounts {
+		row, err := measure(config, corpusDir, *mode, workers)
+		if err != nil {
+			internal.FatalError("measuring workers=%d: %v", workers, err)
+		}
+		internal.InfoMessage("workers=%d: %.1f files/s, %.1f MB/s, p50=%.2fms p99=%.2fms",
+			row.Workers, row.FilesPerSecond, row.MBPerSecond, row.P50FileMs, row.P99FileMs)
+		report.Rows = append(report.Rows, row)
 	}
 
-	langConfig, err := config.GetLanguageConfig(lang)
+	out, err := json.MarshalIndent(report, "", "  ")
 	if err != nil {
-		internal.FatalError("language config: %v", err)
+		internal.FatalError("marshaling report: %v", err)
 	}
+	fmt.Println(string(out))
+}
+
+// measure runs one full corpus scan at the given worker count and converts
+// the scan profile into a report row.
+func measure(config internal.Config, corpusDir, mode string, workers int) (benchRow, error) {
+	processor := internal.NewDirProcessor(config, workers, true, false, mode)
+	profile := internal.NewScanProfile(processor.Workers())
+	profile.EnableLatencies()
+	processor.SetProfile(profile)
+
+	if err := processor.ProcessDirectoryStream(corpusDir, func(internal.DirResult) {}); err != nil {
+		return benchRow{}, err
+	}
+
+	r := profile.Report()
+	return benchRow{
+		Workers:        r.Workers,
+		Files:          r.FilesProcessed,
+		Bytes:          r.BytesProcessed,
+		WallSeconds:    r.WallSeconds,
+		FilesPerSecond: r.FilesPerSecond,
+		MBPerSecond:    r.BytesPerSecond / (1024 * 1024),
+		P50FileMs:      r.P50FileSeconds * 1000,
+		P99FileMs:      r.P99FileSeconds * 1000,
+		SymbolsFound:   r.SymbolsFound,
+	}, nil
+}
 
-	// Warm up
-	finder := internal.CreateFinder(langConfig, "", "map", false, false)
-	_, err = finder.FindFunctions(filename)
+// buildCorpus replicates every supported file from seedDir scale times into a
+// temp directory (rep_000/, rep_001/, …) so directory-mode behavior — walk
+// fan-out, shard grouping, scheduling — is exercised at realistic size while
+// the content stays pinned to the checked-in examples.
+func buildCorpus(config internal.Config, seedDir string, scale int) (string, error) {
+	entries, err := os.ReadDir(seedDir)
 	if err != nil {
-		internal.FatalError("warm up: %v", err)
+		return "", err
 	}
 
-	// Benchmark
-	start := time.Now()
-	for i := 0; i < *iterations; i++ {
-		finder := internal.CreateFinder(langConfig, "", "map", false, false)
-		_, err := finder.FindFunctions(filename)
+	type seed struct {
+		name string
+		data []byte
+	}
+	var seeds []seed
+	for _, entry := range entries {
+		if entry.IsDir() {
+			continue
+		}
+		path := filepath.Join(seedDir, entry.Name())
+		if config.GetLanguageByExtension(path) == nil {
+			continue // AGENTS.md and friends
+		}
+		data, err := os.ReadFile(path)
 		if err != nil {
-			internal.FatalError("iteration %d: %v", i, err)
+			return "", err
+		}
+		seeds = append(seeds, seed{name: entry.Name(), data: data})
+	}
+	if len(seeds) == 0 {
+		return "", fmt.Errorf("no supported files in %s", seedDir)
+	}
+
+	dir, err := os.MkdirTemp("", "ffbench-corpus-")
+	if err != nil {
+		return "", err
+	}
+	for rep := 0; rep < scale; rep++ {
+		repDir := filepath.Join(dir, fmt.Sprintf("rep_%03d", rep))
+		if err := os.MkdirAll(repDir, 0755); err != nil {
+			os.RemoveAll(dir) //nolint:errcheck
+			return "", err
+		}
+		for _, s := range seeds {
+			if err := os.WriteFile(filepath.Join(repDir, s.name), s.data, 0644); err != nil {
+				os.RemoveAll(dir) //nolint:errcheck
+				return "", err
+			}
 		}
 	}
-	elapsed := time.Since(start)
-
-	avgMs := float64(elapsed.Microseconds()) / float64(*iterations) / 1000.0
-	throughput := float64(*iterations) / elapsed.Seconds()
-
-	fmt.Printf("Benchmark Results\n")
-	fmt.Printf("=================\n")
-	fmt.Printf("File:            %s\n", filename)
-	fmt.Printf("Iterations:      %d\n", *iterations)
-	fmt.Printf("Total time:      %v\n", elapsed)
-	fmt.Printf("Avg per iter:    %.3f ms\n", avgMs)
-	fmt.Printf("Throughput:      %.1f files/sec\n", throughput)
+	return dir, nil
+}
+
+func parseWorkerCounts(list string) ([]int, error) {
+	var counts []int
+	for _, part := range strings.Split(list, ",") {
+		part = strings.TrimSpace(part)
+		if part == "" {
+			continue
+		}
+		n, err := strconv.Atoi(part)
+		if err != nil || n <= 0 {
+			return nil, fmt.Errorf("invalid worker count %q", part)
+		}
+		counts = append(counts, n)
+	}
+	if len(counts) == 0 {
+		return nil, fmt.Errorf("no worker counts given")
+	}
+	return counts, nil
 }
@@ -24,6 +24,7 @@ func main() {
 	funcFilter := ""
 	depth := 0
 	noGitignore := false
+	cacheMode := false
 
 	for i := 1; i < len(os.Args); i++ {
 		arg := os.Args[i]
@@ -54,6 +55,8 @@ func main() {
 			i++
 		case arg == "--no-gitignore":
 			noGitignore = true
+		case arg == "--cache":
+			cacheMode = true
 		case !strings.HasPrefix(arg, "-") && dir == "" && inp == "":
 			dir = arg
 		}
@@ -71,7 +74,7 @@ func main() {
 	if inp != "" {
 		runFileMode(config, inp, lang, jsonOut, reverseMode, funcFilter, depth)
 	} else if dir != "" {
-		runDirMode(config, dir, lang, jsonOut, reverseMode, funcFilter, depth, noGitignore)
+		runDirMode(config, dir, lang, jsonOut, reverseMode, funcFilter, depth, noGitignore, cacheMode)
 	} else {
 		internal.FatalError("either --dir or --inp must be specified")
 	}
@@ -96,7 +99,7 @@ func runFileMode(config internal.Config, inp, lang string, jsonOut, reverseMode
 	output(cg, jsonOut, reverseMode, funcFilter, depth)
 }
 
-func runDirMode(config internal.Config, dir, lang string, jsonOut, reverseMode bool, funcFilter string, depth int, noGitignore bool) {
+func runDirMode(config internal.Config, dir, lang string, jsonOut, reverseMode bool, funcFilter string, depth int, noGitignore, cacheMode bool) {
 	var langConfig *internal.LanguageConfig
 	var err error
 	if lang != "" {
@@ -106,21 +109,6 @@ func runDirMode(config internal.Config, dir, lang string, jsonOut, reverseMode b
 		}
 	}
 
-	// Collect files
-	var allFiles []string
-	if langConfig != nil {
-		allFiles, err = internal.CollectSourceFiles(dir, langConfig, true, !noGitignore)
-	} else {
-		// Auto-detect: collect all supported files
-		for _, lc := range config {
-			files, _ := internal.CollectSourceFiles(dir, lc, true, !noGitignore)
-			allFiles = append(allFiles, files...)
-		}
-	}
-	if err != nil {
-		internal.FatalError("collecting files: %v", err)
-	}
-
 	// Run funcfinder on each file to get function boundaries. When -l is set,
 	// scope this to that single language too — otherwise DirProcessor
 	// auto-detects and processes every supported language in dir regardless
@@ -131,22 +119,59 @@ func runDirMode(config internal.Config, dir, lang string, jsonOut, reverseMode b
 		procConfig = internal.Config{lang: langConfig}
 	}
 	processor := internal.NewDirProcessor(procConfig, 0, true, !noGitignore, "functions")
+	if cacheMode {
+		// Function bounds come from the same checksum-validated cache that
+		// funcfinder --cache uses, so unchanged files skip the finder too.
+		processor.SetResultCache(internal.LoadResultCache(internal.ResultCacheFile))
+	}
 	results, err := processor.ProcessDirectory(dir)
 	if err != nil {
 		internal.FatalError("processing directory: %v", err)
 	}
 
-	// Collect per-file import aliases
-	importsByFile := make(map[string]map[string]string)
-	for _, path := range allFiles {
-		lc := config.GetLanguageByExtension(path)
-		if lc == nil {
-			continue
+	var cg *internal.CallGraphResult
+	if cacheMode {
+		// Incremental path: edges are spliced from the persisted store,
+		// imports are only re-scanned for files that actually changed.
+		store := internal.LoadCallGraphStore(internal.CallGraphStoreFile)
+		importsFor := func(path string) map[string]string {
+			lc := config.GetLanguageByExtension(path)
+			if lc == nil {
+				return nil
+			}
+			return collectImports(path, lc)
+		}
+		cg = internal.BuildDirCallGraphIncremental(results, config, importsFor, store)
+		if err := store.Save(); err != nil {
+			internal.WarnError("saving call-graph store: %v", err)
+		}
+	} else {
+		// Collect files for per-file import aliases
+		var allFiles []string
+		if langConfig != nil {
+			allFiles, err = internal.CollectSourceFiles(dir, langConfig, true, !noGitignore)
+			if err != nil {
+				internal.FatalError("collecting files: %v", err)
+			}
+		} else {
+			// Auto-detect: collect all supported files
+			for _, lc := range config {
+				files, _ := internal.CollectSourceFiles(dir, lc, true, !noGitignore)
+				allFiles = append(allFiles, files...)
+			}
 		}
-		importsByFile[path] = collectImports(path, lc)
-	}
 
-	cg := internal.BuildDirCallGraph(results, config, importsByFile)
+		importsByFile := make(map[string]map[string]string)
+		for _, path := range allFiles {
+			lc := config.GetLanguageByExtension(path)
+			if lc == nil {
+				continue
+			}
+			importsByFile[path] = collectImports(path, lc)
+		}
+
+		cg = internal.BuildDirCallGraph(results, config, importsByFile)
+	}
 	output(cg, jsonOut, reverseMode, funcFilter, depth)
 
 	internal.InfoMessage("Analyzed %d files, found %d call edges across %d functions",
@@ -348,5 +373,6 @@ func printHelp() {
 	fmt.Println("  --func <name>      Focus on one function (with optional --depth)")
 	fmt.Println("  --depth <n>        Limit traversal depth (default: unlimited)")
 	fmt.Println("  --no-gitignore     Ignore .gitignore rules")
+	fmt.Println("  --cache            Incremental mode: persist per-file results and call edges, re-extract only changed files")
 	fmt.Println("  --version          Print version")
 }
@@ -15,8 +15,10 @@ import (
 	"os"
 	"path/filepath"
 	"regexp"
+	"runtime"
 	"sort"
 	"strings"
+	"sync"
 
 	"github.com/ruslano69/funcfinder/internal"
 )
@@ -169,7 +171,7 @@ var flatPatterns = map[string]*regexp.Regexp{
 // "complexity -l js file.go").
 func reorderArgs(args []string) []string {
 	// Flags that consume the next argument as their value.
-	valueFlags := map[string]bool{"l": true, "t": true, "n": true}
+	valueFlags := map[string]bool{"l": true, "t": true, "n": true, "w": true}
 
 	var flags []string
 	var positional []string
@@ -206,6 +208,7 @@ func main() {
 	topN := flag.Int("n", 0, "Show top N most complex functions")
 	showDetails := flag.Bool("v", false, "Show detailed nesting analysis")
 	noSimple := flag.Bool("nosimple", false, "Hide SIMPLE level functions (depth <= 2)")
+	workersFlag := flag.Int("w", 0, "Number of parallel workers (0 = number of CPUs)")
 	flag.Parse()
 
 	// Handle version flag
@@ -255,13 +258,12 @@ func main() {
 	if walkErr != nil {
 		internal.FatalError("walking directory: %v", walkErr)
 	}
-	for _, path := range dirFiles {
-		fileComplexity := analyzeFileComplexity(path, langConfig)
-		if fileComplexity.TotalFunctions > 0 {
-			allFiles = append(allFiles, fileComplexity)
-			totalFunctions += fileComplexity.TotalFunctions
-			totalComplexity += fileComplexity.MaxComplexity
-		}
+	// Files are analyzed by a worker pool and aggregated as results stream
+	// in, so parsing and aggregation overlap instead of running back-to-back.
+	for fileComplexity := range analyzeFilesParallel(dirFiles, langConfig, *workersFlag) {
+		allFiles = append(allFiles, fileComplexity)
+		totalFunctions += fileComplexity.TotalFunctions
+		totalComplexity += fileComplexity.MaxComplexity
 	}
 
 	if len(allFiles) == 0 {
@@ -413,8 +415,49 @@ func getDepthThreshold(level ComplexityLevel) int {
 	}
 }
 
+// analyzeFilesParallel fans the files out to a worker pool, mirroring the
+// engine behind funcfinder's -dir mode (DirProcessor.processFilesParallel):
+// each worker keeps one finder and one set of compiled patterns for its whole
+// run, and finished FileComplexity values are streamed to the caller as they
+// complete. Files with no functions are dropped at the source.
+func analyzeFilesParallel(paths []string, langConfig *internal.LanguageConfig, workers int) <-chan FileComplexity {
+	if workers <= 0 {
+		workers = runtime.NumCPU()
+	}
+	jobs := make(chan string, workers*4)
+	out := make(chan FileComplexity, workers*4)
+
+	var wg sync.WaitGroup
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			finder := internal.CreateFinder(langConfig, "", "map", false, false)
+			nestingRe := getNestingPattern(langConfig.LangKey)
+			flatRe := getFlatPattern(langConfig.LangKey)
+			for path := range jobs {
+				fc := analyzeFileComplexity(path, langConfig, finder, nestingRe, flatRe)
+				if fc.TotalFunctions > 0 {
+					out <- fc
+				}
+			}
+		}()
+	}
+
+	go func() {
+		for _, path := range paths {
+			jobs <- path
+		}
+		close(jobs)
+		wg.Wait()
+		close(out)
+	}()
+
+	return out
+}
+
 // analyzeFileComplexity calculates nesting complexity for all functions in a file
-func analyzeFileComplexity(filename string, langConfig *internal.LanguageConfig) FileComplexity {
+func analyzeFileComplexity(filename string, langConfig *internal.LanguageConfig, finder internal.LanguageFinder, nestingRe, flatRe *regexp.Regexp) FileComplexity {
 	file, err := os.Open(filename)
 	if err != nil {
 		return FileComplexity{Filename: filename}
@@ -428,17 +471,12 @@ func analyzeFileComplexity(filename string, langConfig *internal.LanguageConfig)
 		lines = append(lines, scanner.Text())
 	}
 
-	// Use finder to get function bounds (auto-selects PythonFinder for Python)
-	finder := internal.CreateFinder(langConfig, "", "map", false, false)
+	// Finder comes from the worker (auto-selects PythonFinder for Python)
 	result, err := finder.FindFunctions(filename)
 	if err != nil {
 		return FileComplexity{Filename: filename}
 	}
 
-	// Get patterns for language
-	nestingRe := getNestingPattern(langConfig.LangKey)
-	flatRe := getFlatPattern(langConfig.LangKey)
-
 	var functions []ComplexityMetrics
 	maxFileComplexity := 0
 
@@ -1,10 +1,14 @@
 package main
 
 import (
+	"encoding/json"
 	"flag"
 	"fmt"
+	"net/http"
+	_ "net/http/pprof" //nolint:gosec // dev-only endpoint, enabled explicitly by --profile
 	"os"
 	"strings"
+	"time"
 
 	"github.com/ruslano69/funcfinder/internal"
 )
@@ -22,12 +26,14 @@ func main() {
 	workers := flag.Int("workers", 0, "number of parallel workers (default: number of CPU cores)")
 	recursive := flag.Bool("recursive", true, "scan directories recursively")
 	noGitignore := flag.Bool("no-gitignore", false, "ignore .gitignore files")
+	cacheMode := flag.Bool("cache", false, "cache per-file results in "+internal.ResultCacheFile+" and skip unchanged files (--dir mode)")
 
 	// Function/Type finding flags
 	funcStr := flag.String("func", "", "function names to find (comma-separated)")
 	structMode := flag.Bool("struct", false, "find structs/classes/types instead of functions")
 	typeStr := flag.String("type", "", "type names to find (comma-separated)")
 	allMode := flag.Bool("all", false, "find both functions and structs")
+	firstMatch := flag.Bool("first-match", false, "stop searching once every requested --func name has been found once")
 
 	// Output mode flags
 	mapMode := flag.Bool("map", false, "map all functions/types in file(s)")
@@ -40,11 +46,27 @@ func main() {
 	rawMode := flag.Bool("raw", false, "include raw strings in brace counting")
 	linesRange := flag.String("lines", "", "extract specific line range (format: start:end, :end, start:, or single line)")
 
+	// Serve mode flags (persistent daemon with in-memory index)
+	serveMode := flag.Bool("serve", false, "run as a persistent query server over a unix socket (--dir mode only)")
+	socketPath := flag.String("socket", ".funcfinder.sock", "unix socket path for --serve / --query")
+	queryOp := flag.String("query", "", "query a running --serve instance: map, func, struct, rescan, or shutdown")
+	watchMode := flag.Bool("watch", false, "with --serve: poll for file changes and reindex only what changed")
+	watchInterval := flag.Duration("watch-interval", 500*time.Millisecond, "poll interval for --watch")
+
+	// Profiling flags (--dir mode)
+	profileMode := flag.Bool("profile", false, "collect per-stage scan metrics, serve net/http/pprof, and print a JSON epilogue to stderr")
+	pprofAddr := flag.String("pprof-addr", "localhost:6060", "listen address for the pprof endpoint enabled by --profile")
+
 	// Split output flags (for --dir mode)
 	splitMode := flag.Bool("split", false, "split output into manifest + shard files (--dir mode only)")
 	splitBy := flag.String("split-by", "dir", "split granularity: 'dir' (one shard per directory) or 'file' (one shard per file)")
 	outDir := flag.String("out", ".codemap", "output directory for split files")
 	incMode := flag.Bool("inc", false, "incremental split update using shard checksums (--split --json --dir)")
+	compressMode := flag.Bool("compress", false, "gzip-compress shard files (--split); readers decode them transparently")
+
+	// Multi-process sharded execution (--dir mode)
+	shardSpec := flag.String("shard", "", "process only slice index/total of the shard space, e.g. 0/4 (--dir mode)")
+	mergeShards := flag.String("merge-shards", "", "comma-separated --split output dirs from sharded runs to merge into --out")
 
 	// Pre-process args to support --struct "TypeA,TypeB" syntax:
 	// transforms "--struct Names --extract" into "--struct --type Names --extract"
@@ -56,6 +78,30 @@ func main() {
 		internal.PrintVersion("funcfinder")
 	}
 
+	// Client mode: forward the query to a running --serve instance.
+	// No config loading or scanning happens on this side.
+	if *queryOp != "" {
+		handleQueryMode(*socketPath, *queryOp, *funcStr, *typeStr)
+		return
+	}
+
+	// Merge mode: combine split outputs produced by --shard runs. No
+	// scanning happens; the parts already carry results and checksums.
+	if *mergeShards != "" {
+		var parts []string
+		for _, p := range strings.Split(*mergeShards, ",") {
+			if p = strings.TrimSpace(p); p != "" {
+				parts = append(parts, p)
+			}
+		}
+		summary, err := internal.MergeShardOutputs(parts, *outDir)
+		if err != nil {
+			internal.FatalError("merging shard outputs: %v", err)
+		}
+		fmt.Println(summary)
+		return
+	}
+
 	// Валидация: либо -inp либо -dir должно быть указано
 	if *inp == "" && *dir == "" {
 		internal.FatalError("either --inp (single file) or --dir (directory) parameter is required")
@@ -71,22 +117,43 @@ func main() {
 		internal.FatalError("loading config: %v", err)
 	}
 
+	// Serve mode: scan once, then answer queries from memory
+	if *serveMode {
+		if *dir == "" {
+			internal.FatalError("--serve requires --dir")
+		}
+		handleServeMode(config, *dir, *workers, *recursive, !*noGitignore, *socketPath, *watchMode, *watchInterval)
+		return
+	}
+
+	// Профилирование: pprof поднимаем до начала сканирования, чтобы можно
+	// было снять профиль прямо во время run'а
+	if *profileMode {
+		go func() {
+			if err := http.ListenAndServe(*pprofAddr, nil); err != nil {
+				internal.WarnError("pprof listener: %v", err)
+			}
+		}()
+		internal.InfoMessage("pprof available at http://%s/debug/pprof/", *pprofAddr)
+	}
+
 	// Режим обработки каталога
 	if *dir != "" {
 		// Автоматически включаем --map если не указан другой режим вывода
+		// (кроме целевого поиска --func: он работает как grep по каталогу)
 		autoMapMode := *mapMode
-		if !*mapMode && !*treeMode && !*treeFull {
+		if !*mapMode && !*treeMode && !*treeFull && *funcStr == "" {
 			autoMapMode = true
 		}
-		handleDirectoryMode(config, *dir, *workers, *recursive, !*noGitignore, *funcStr, autoMapMode, *treeMode, *treeFull, *jsonOut, *extract, *structMode, *allMode, *splitMode, *splitBy, *outDir, *incMode)
+		handleDirectoryMode(config, *dir, *workers, *recursive, !*noGitignore, *cacheMode, *funcStr, autoMapMode, *treeMode, *treeFull, *jsonOut, *extract, *structMode, *allMode, *splitMode, *splitBy, *outDir, *incMode, *compressMode, *profileMode, *shardSpec, *firstMatch)
 		return
 	}
 
 	// Режим обработки одного файла (существующая логика)
-	handleFileMode(config, *inp, *source, *funcStr, *typeStr, *structMode, *allMode, *mapMode, *treeMode, *treeFull, *jsonOut, *extract, *rawMode, *linesRange)
+	handleFileMode(config, *inp, *source, *funcStr, *typeStr, *structMode, *allMode, *mapMode, *treeMode, *treeFull, *jsonOut, *extract, *rawMode, *linesRange, *firstMatch)
 }
 
-func handleDirectoryMode(config internal.Config, dirPath string, workers int, recursive, useGitignore bool, funcStr string, mapMode, treeMode, treeFull, jsonOut, extract, structMode, allMode, splitMode bool, splitBy, outDir string, incMode bool) {
+func handleDirectoryMode(config internal.Config, dirPath string, workers int, recursive, useGitignore, cacheMode bool, funcStr string, mapMode, treeMode, treeFull, jsonOut, extract, structMode, allMode, splitMode bool, splitBy, outDir string, incMode, compressMode, profileMode bool, shardSpec string, firstMatch bool) {
 	// Проверяем существование директории
 	info, err := os.Stat(dirPath)
 	if err != nil {
@@ -116,6 +183,14 @@ func handleDirectoryMode(config internal.Config, dirPath string, workers int, re
 	if funcStr != "" && (mapMode || treeMode || treeFull) {
 		internal.FatalError("--func is mutually exclusive with --map and --tree")
 	}
+	if funcStr != "" {
+		if workMode != "functions" {
+			internal.FatalError("--func cannot be used with --struct or --all in --dir mode")
+		}
+		if splitMode {
+			internal.FatalError("--func cannot be combined with --split")
+		}
+	}
 
 	if treeMode && treeFull {
 		internal.FatalError("--tree and --tree-full are mutually exclusive")
@@ -138,8 +213,98 @@ func handleDirectoryMode(config internal.Config, dirPath string, workers int, re
 
 	// Создаем процессор директорий
 	processor := internal.NewDirProcessor(config, workers, recursive, useGitignore, workMode)
+	if cacheMode {
+		processor.SetResultCache(internal.LoadResultCache(internal.ResultCacheFile))
+	}
+	if shardSpec != "" {
+		slice, err := internal.ParseShardSlice(shardSpec)
+		if err != nil {
+			internal.FatalError("%v", err)
+		}
+		processor.SetShardSlice(slice)
+		internal.InfoMessage("Shard slice %d/%d: processing owned directories only", slice.Index, slice.Total)
+	}
+	if profileMode {
+		profile := internal.NewScanProfile(processor.Workers())
+		processor.SetProfile(profile)
+		// Эпилог уходит в stderr, чтобы не ломать JSON/grep вывод в stdout
+		defer printScanProfile(profile)
+	}
+
+	// Целевой поиск по каталогу: выводятся только функции с запрошенными
+	// именами. С --first-match обход отменяется, как только каждое имя
+	// найдено хотя бы раз — оставшиеся файлы не читаются вовсе.
+	if funcStr != "" {
+		wanted := make(map[string]bool)
+		for _, name := range internal.ParseFuncNames(funcStr) {
+			wanted[name] = true
+		}
+		resolved := make(map[string]bool, len(wanted))
+		writer := internal.NewDirResultWriter(os.Stdout, jsonOut)
+		err := processor.ProcessDirectoryStreamUntil(dirPath, func(r internal.DirResult) bool {
+			matched := make([]internal.FunctionBounds, 0, len(wanted))
+			for _, fn := range r.Functions {
+				if wanted[fn.Name] {
+					matched = append(matched, fn)
+					resolved[fn.Name] = true
+				}
+			}
+			if len(matched) == 0 && r.Error == nil {
+				return true
+			}
+			r.Functions = matched
+			r.Classes = nil
+			if err := writer.WriteResult(r); err != nil {
+				internal.FatalError("writing output: %v", err)
+			}
+			return !firstMatch || len(resolved) < len(wanted)
+		})
+		if err != nil {
+			internal.FatalError("processing directory: %v", err)
+		}
+		if err := writer.Close(); err != nil {
+			internal.FatalError("writing output: %v", err)
+		}
+
+		totalFiles, totalFuncs, _ := writer.Totals()
+		if totalFuncs == 0 {
+			internal.FatalErrorWithCode(2, "Specified functions not found")
+		}
+		for name := range wanted {
+			if !resolved[name] {
+				internal.WarnError("function not found: %s", name)
+			}
+		}
+		internal.InfoMessage("Matched %d functions in %d files", totalFuncs, totalFiles)
+		return
+	}
+
+	// Streaming path: grep/JSON list output needs no global view, so each
+	// file's results are printed as its worker finishes and then released —
+	// memory stays O(largest file) instead of O(repo).
+	if !splitMode && !treeMode && !treeFull {
+		writer := internal.NewDirResultWriter(os.Stdout, jsonOut)
+		if err := processor.ProcessDirectoryStream(dirPath, func(r internal.DirResult) {
+			if err := writer.WriteResult(r); err != nil {
+				internal.FatalError("writing output: %v", err)
+			}
+		}); err != nil {
+			internal.FatalError("processing directory: %v", err)
+		}
+		if err := writer.Close(); err != nil {
+			internal.FatalError("writing output: %v", err)
+		}
+
+		totalFiles, totalFuncs, totalClasses := writer.Totals()
+		if workMode == "all" || workMode == "structs" {
+			internal.InfoMessage("Processed %d files, found %d functions, %d classes/types", totalFiles, totalFuncs, totalClasses)
+		} else {
+			internal.InfoMessage("Processed %d files, found %d functions", totalFiles, totalFuncs)
+		}
+		return
+	}
 
-	// Обрабатываем директорию
+	// Обрабатываем директорию (tree/split режимы требуют полный результат)
 	var results []internal.DirResult
 	if splitMode && incMode {
 		results, err = processor.ProcessDirectoryIncremental(dirPath, outDir, splitBy)
@@ -154,9 +319,9 @@ func handleDirectoryMode(config internal.Config, dirPath string, workers int, re
 	if splitMode {
 		var manifest string
 		if incMode {
-			manifest, err = internal.WriteSplitOutputIncremental(results, outDir, dirPath, splitBy)
+			manifest, err = internal.WriteSplitOutputIncremental(results, outDir, dirPath, splitBy, compressMode)
 		} else {
-			manifest, err = internal.WriteSplitOutput(results, outDir, dirPath, splitBy)
+			manifest, err = internal.WriteSplitOutput(results, outDir, dirPath, splitBy, compressMode)
 		}
 		if err != nil {
 			internal.FatalError("writing split output: %v", err)
@@ -185,7 +350,61 @@ func handleDirectoryMode(config internal.Config, dirPath string, workers int, re
 	}
 }
 
-func handleFileMode(config internal.Config, inp, source, funcStr, typeStr string, structMode, allMode, mapMode, treeMode, treeFull, jsonOut, extract, rawMode bool, linesRange string) {
+// printScanProfile marshals the --profile epilogue to stderr.
+func printScanProfile(profile *internal.ScanProfile) {
+	b, err := json.MarshalIndent(profile.Report(), "", "  ")
+	if err != nil {
+		internal.WarnError("marshaling scan profile: %v", err)
+		return
+	}
+	fmt.Fprintln(os.Stderr, string(b))
+}
+
+// handleServeMode runs the persistent query server: one full scan up front,
+// then map/func/struct lookups answered from memory over a unix socket.
+func handleServeMode(config internal.Config, dirPath string, workers int, recursive, useGitignore bool, socketPath string, watch bool, watchInterval time.Duration) {
+	info, err := os.Stat(dirPath)
+	if err != nil || !info.IsDir() {
+		internal.FatalError("directory does not exist: %s", dirPath)
+	}
+
+	// Index both functions and types so every query op can be served.
+	processor := internal.NewDirProcessor(config, workers, recursive, useGitignore, "all")
+	server := internal.NewQueryServer(processor, dirPath)
+	if watch {
+		stop := make(chan struct{})
+		defer close(stop)
+		go server.Watch(watchInterval, stop)
+	}
+	if err := server.Serve(socketPath); err != nil {
+		internal.FatalError("serve: %v", err)
+	}
+}
+
+// handleQueryMode sends one request to a running --serve instance and prints
+// the JSON response.
+func handleQueryMode(socketPath, op, funcStr, typeStr string) {
+	names := internal.ParseFuncNames(funcStr)
+	if typeStr != "" {
+		names = append(names, internal.ParseFuncNames(typeStr)...)
+	}
+
+	resp, err := internal.QueryServe(socketPath, &internal.ServeRequest{Op: op, Names: names})
+	if err != nil {
+		internal.FatalError("%v", err)
+	}
+	if !resp.OK {
+		internal.FatalError("server: %s", resp.Error)
+	}
+
+	out, err := json.MarshalIndent(resp, "", "  ")
+	if err != nil {
+		internal.FatalError("formatting output: %v", err)
+	}
+	fmt.Println(string(out))
+}
+
+func handleFileMode(config internal.Config, inp, source, funcStr, typeStr string, structMode, allMode, mapMode, treeMode, treeFull, jsonOut, extract, rawMode bool, linesRange string, firstMatch bool) {
 	// --source не обязателен если используется только --lines (standalone mode)
 	standaloneLines := linesRange != "" && source == ""
 
@@ -277,7 +496,7 @@ func handleFileMode(config internal.Config, inp, source, funcStr, typeStr string
 	// Обработка в зависимости от workMode
 	switch workMode {
 	case "functions":
-		processFunctions(langConfig, funcStr, mode, extractMode, rawMode, inp, linesRange, mapMode, treeMode, treeFull, jsonOut, extract)
+		processFunctions(langConfig, funcStr, mode, extractMode, rawMode, inp, linesRange, mapMode, treeMode, treeFull, jsonOut, extract, firstMatch)
 
 	case "structs":
 		processStructs(langConfig, typeStr, mode, extractMode, inp, linesRange, mapMode, treeMode, treeFull, jsonOut, extract)
@@ -288,9 +507,20 @@ func handleFileMode(config internal.Config, inp, source, funcStr, typeStr string
 }
 
 // processFunctions обрабатывает режим поиска функций (по умолчанию)
-func processFunctions(langConfig *internal.LanguageConfig, funcStr, mode string, extractMode, rawMode bool, inp, linesRange string, mapMode, treeMode, treeFull, jsonOut, extract bool) {
+func processFunctions(langConfig *internal.LanguageConfig, funcStr, mode string, extractMode, rawMode bool, inp, linesRange string, mapMode, treeMode, treeFull, jsonOut, extract, firstMatch bool) {
+	// Ленивая экстракция: для --extract тела не копируются в Lines, а
+	// читаются форматтером напрямую из файла по диапазону Start..End.
+	// Копии (extractMode у finder'а) нужны только --tree-full — там
+	// сигнатуры извлекаются из Lines.
+	if extract && !treeFull {
+		extractMode = false
+	}
+
 	// Создаем подходящий парсер в зависимости от языка
 	finder := internal.CreateFinder(langConfig, funcStr, mode, extractMode, rawMode)
+	if firstMatch {
+		internal.SetFirstMatch(finder, true)
+	}
 
 	var result *internal.FindResult
 	var err error
@@ -378,7 +608,10 @@ func processFunctions(langConfig *internal.LanguageConfig, funcStr, mode string,
 	// Форматируем и выводим результат
 	var output string
 	if extract {
-		output = internal.FormatExtract(result)
+		if err := internal.FormatExtractTo(os.Stdout, result, inp); err != nil {
+			internal.FatalError("formatting output: %v", err)
+		}
+		return
 	} else if jsonOut {
 		output, err = internal.FormatJSON(result)
 		if err != nil {
@@ -462,8 +695,10 @@ func processAll(langConfig *internal.LanguageConfig, mode string, extractMode, r
 		internal.FatalError("--lines is not yet supported with --all mode")
 	}
 
-	// Создаем function finder (всегда в режиме "map")
-	funcFinder := internal.CreateFinder(langConfig, "", "map", extractMode, rawMode)
+	// Создаем function finder (всегда в режиме "map"). Тела для --extract
+	// читаются лениво форматтером, поэтому копии в Lines нужны только
+	// --tree-full (сигнатуры).
+	funcFinder := internal.CreateFinder(langConfig, "", "map", extractMode && !extract, rawMode)
 	funcResult, err := funcFinder.FindFunctions(inp)
 	if err != nil {
 		internal.FatalError("finding functions: %v", err)
@@ -497,7 +732,9 @@ func processAll(langConfig *internal.LanguageConfig, mode string, extractMode, r
 	} else if extract {
 		if funcCount > 0 {
 			fmt.Println("=== FUNCTIONS ===")
-			fmt.Println(internal.FormatExtract(funcResult))
+			if err := internal.FormatExtractTo(os.Stdout, funcResult, inp); err != nil {
+				internal.FatalError("formatting output: %v", err)
+			}
 		}
 		if typeCount > 0 {
 			if funcCount > 0 {
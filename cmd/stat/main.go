@@ -4,13 +4,17 @@ package main
 
 import (
 	"bufio"
+	"container/heap"
 	"encoding/json"
 	"fmt"
 	"os"
 	"path/filepath"
 	"regexp"
+	"runtime"
 	"sort"
+	"strconv"
 	"strings"
+	"sync"
 
 	"github.com/ruslano69/funcfinder/internal"
 )
@@ -30,20 +34,6 @@ type StatResult struct {
 	TopCalls     []CallEntry `json:"top_calls"`
 }
 
-// DirStatResult is the JSON output structure for directory mode.
-type DirStatResult struct {
-	Language     string      `json:"language"`
-	Dir          string      `json:"dir"`
-	TotalFiles   int         `json:"total_files"`
-	TotalLines   int         `json:"total_lines"`
-	CodeLines    int         `json:"code_lines"`
-	CommentLines int         `json:"comment_lines"`
-	BlankLines   int         `json:"blank_lines"`
-	UniqueCalls  int         `json:"unique_calls"`
-	TopCalls     []CallEntry `json:"top_calls"`
-	Files        []StatResult `json:"files"`
-}
-
 type CallEntry struct {
 	Name  string `json:"name"`
 	Count int    `json:"count"`
@@ -196,40 +186,60 @@ func analyzeFile(filename string, config *internal.LanguageConfig) (map[string]i
 	return callCounts, metrics
 }
 
-// sortedCalls converts a callCounts map to a sorted slice of pairs.
-func sortedCalls(callCounts map[string]int) []struct{ name string; count int } {
-	type pair struct {
-		name  string
-		count int
+// callTopN keeps only the N highest-count calls with a bounded min-heap, so
+// the cost of a top list no longer scales with how many distinct calls a repo
+// has. With n <= 0 it collects everything and Final just sorts.
+type callTopN struct {
+	n       int
+	entries []CallEntry
+}
+
+func (h *callTopN) Len() int           { return len(h.entries) }
+func (h *callTopN) Less(i, j int) bool { return h.entries[i].Count < h.entries[j].Count }
+func (h *callTopN) Swap(i, j int)      { h.entries[i], h.entries[j] = h.entries[j], h.entries[i] }
+func (h *callTopN) Push(x any)         { h.entries = append(h.entries, x.(CallEntry)) }
+func (h *callTopN) Pop() any {
+	last := h.entries[len(h.entries)-1]
+	h.entries = h.entries[:len(h.entries)-1]
+	return last
+}
+
+// Add offers one call to the heap, evicting the current minimum when full.
+func (h *callTopN) Add(name string, count int) {
+	if h.n <= 0 {
+		h.entries = append(h.entries, CallEntry{Name: name, Count: count})
+		return
 	}
-	var calls []pair
-	for name, count := range callCounts {
-		calls = append(calls, pair{name, count})
+	if len(h.entries) < h.n {
+		heap.Push(h, CallEntry{Name: name, Count: count})
+		return
 	}
-	sort.Slice(calls, func(i, j int) bool { return calls[i].count > calls[j].count })
-	result := make([]struct{ name string; count int }, len(calls))
-	for i, c := range calls {
-		result[i].name = c.name
-		result[i].count = c.count
+	if count > h.entries[0].Count {
+		h.entries[0] = CallEntry{Name: name, Count: count}
+		heap.Fix(h, 0)
 	}
-	return result
 }
 
-// toCallEntries converts a sorted calls slice to JSON-ready CallEntry slice, capped at topN.
-func toCallEntries(calls []struct{ name string; count int }, topN int) []CallEntry {
-	entries := calls
-	if topN > 0 && topN < len(entries) {
-		entries = entries[:topN]
-	}
-	out := make([]CallEntry, len(entries))
-	for i, c := range entries {
-		out[i] = CallEntry{Name: c.name, Count: c.count}
-	}
+// Final returns the kept entries ordered by count descending.
+func (h *callTopN) Final() []CallEntry {
+	out := make([]CallEntry, len(h.entries))
+	copy(out, h.entries)
+	sort.Slice(out, func(i, j int) bool { return out[i].Count > out[j].Count })
 	return out
 }
 
-// printFileStats prints text output for a single analyzed file.
-func printFileStats(filename string, langName string, calls []struct{ name string; count int }, metrics *FileMetrics, topN int) {
+// topCalls reduces a callCounts map to its top-N entries, count descending.
+func topCalls(callCounts map[string]int, topN int) []CallEntry {
+	h := &callTopN{n: topN}
+	for name, count := range callCounts {
+		h.Add(name, count)
+	}
+	return h.Final()
+}
+
+// printFileStats prints text output for a single analyzed file. calls is
+// already capped at top-N; uniqueCalls is the full distinct-call count.
+func printFileStats(filename string, langName string, calls []CallEntry, uniqueCalls int, metrics *FileMetrics) {
 	fmt.Printf("Language: %s\n", langName)
 	fmt.Printf("File: %s (%.1f KB)\n", filepath.Base(filename), float64(metrics.FileSize)/1024)
 	fmt.Println(strings.Repeat("-", 35))
@@ -255,15 +265,11 @@ func printFileStats(filename string, langName string, calls []struct{ name strin
 	}
 
 	fmt.Println(strings.Repeat("-", 35))
-	fmt.Printf("Function calls: %d unique\n", len(calls))
+	fmt.Printf("Function calls: %d unique\n", uniqueCalls)
 	fmt.Println(strings.Repeat("-", 35))
 
-	printCount := len(calls)
-	if topN > 0 && topN < printCount {
-		printCount = topN
-	}
-	for i := 0; i < printCount; i++ {
-		fmt.Printf("%-25s %d\n", calls[i].name, calls[i].count)
+	for _, c := range calls {
+		fmt.Printf("%-25s %d\n", c.Name, c.Count)
 	}
 }
 
@@ -274,6 +280,7 @@ func main() {
 	langFlag := ""
 	topN := 0
 	jsonOut := false
+	shardSpec := ""
 
 	for i := 1; i < len(os.Args); i++ {
 		arg := os.Args[i]
@@ -285,6 +292,7 @@ func main() {
 			fmt.Println("  -l <lang>      Force language (py, go, rs, js, ts, sw, c, cpp, java, d, cs)")
 			fmt.Println("  -n <num>       Show top N functions")
 			fmt.Println("  -j, --json     Output JSON")
+			fmt.Println("  --shard <i/N>  Process only the directories owned by slice i of N (--dir mode)")
 			return
 		} else if arg == "--version" {
 			showVersion = true
@@ -299,6 +307,9 @@ func main() {
 			i++
 		} else if arg == "-j" || arg == "--json" {
 			jsonOut = true
+		} else if arg == "--shard" && i+1 < len(os.Args) {
+			shardSpec = os.Args[i+1]
+			i++
 		} else if !strings.HasPrefix(arg, "-") {
 			filename = arg
 		}
@@ -345,94 +356,162 @@ func main() {
 			internal.FatalError("no supported files found in directory\nSupported languages: %s", strings.Join(config.GetSupportedLanguages(), ", "))
 		}
 
-		// Single pass: collect per-file results and aggregate.
-		type perFile struct {
-			path  string
-			calls []struct{ name string; count int }
-			m     FileMetrics
-		}
-		aggregateCounts := make(map[string]int)
-		var aggMetrics FileMetrics
-		var collected []perFile
-
 		dirFiles, walkErr := internal.CollectSourceFiles(dirMode, langConfig, true)
 		if walkErr != nil {
 			internal.FatalError("walking directory: %v", walkErr)
 		}
-		for _, path := range dirFiles {
-			counts, m := analyzeFile(path, langConfig)
-			for fn, cnt := range counts {
-				aggregateCounts[fn] += cnt
+		// Sharded execution: keep only the directories this slice owns, so
+		// N processes with slices 0/N..N-1/N cover the tree exactly once.
+		if shardSpec != "" {
+			slice, err := internal.ParseShardSlice(shardSpec)
+			if err != nil {
+				internal.FatalError("%v", err)
+			}
+			kept := dirFiles[:0]
+			for _, path := range dirFiles {
+				if slice.Owns(internal.ShardKeyForPath(path, dirMode, "dir")) {
+					kept = append(kept, path)
+				}
 			}
-			aggMetrics.TotalLines += m.TotalLines
-			aggMetrics.CodeLines += m.CodeLines
-			aggMetrics.CommentLines += m.CommentLines
-			aggMetrics.BlankLines += m.BlankLines
-			aggMetrics.FileSize += m.FileSize
-			collected = append(collected, perFile{path: path, calls: sortedCalls(counts), m: *m})
+			dirFiles = kept
+		}
+
+		// Streaming fold over worker results: files are analyzed by a pool
+		// with DirProcessor's worker-count semantics, each result is folded
+		// into running sums and a bounded top-N heap as it arrives and then
+		// dropped — memory stays O(workers + distinct call names) instead of
+		// O(repo). Output is emitted per file in path order.
+		type statOut struct {
+			idx    int
+			counts map[string]int
+			m      *FileMetrics
+		}
+		workers := runtime.NumCPU()
+		jobs := make(chan int)
+		results := make(chan statOut, workers)
+		var wg sync.WaitGroup
+		for w := 0; w < workers; w++ {
+			wg.Add(1)
+			go func() {
+				defer wg.Done()
+				for i := range jobs {
+					counts, m := analyzeFile(dirFiles[i], langConfig)
+					results <- statOut{idx: i, counts: counts, m: m}
+				}
+			}()
 		}
+		go func() {
+			for i := range dirFiles {
+				jobs <- i
+			}
+			close(jobs)
+			wg.Wait()
+			close(results)
+		}()
 
-		aggCalls := sortedCalls(aggregateCounts)
+		aggregateCounts := make(map[string]int)
+		var aggMetrics FileMetrics
+		totalFiles := 0
 
+		out := bufio.NewWriter(os.Stdout)
 		if jsonOut {
-			fileResults := make([]StatResult, len(collected))
-			for i, pf := range collected {
-				fileResults[i] = StatResult{
+			langJSON, _ := json.Marshal(langConfig.Name)
+			dirJSON, _ := json.Marshal(dirMode)
+			out.WriteString("{\n  \"language\": " + string(langJSON) + ",\n") //nolint:errcheck
+			out.WriteString("  \"dir\": " + string(dirJSON) + ",\n")          //nolint:errcheck
+			out.WriteString("  \"files\": [")                                 //nolint:errcheck
+		} else {
+			fmt.Fprintf(out, "Language: %s  Dir: %s\n", langConfig.Name, dirMode)
+			fmt.Fprintln(out, strings.Repeat("=", 45))
+		}
+
+		emit := func(o statOut) {
+			path := dirFiles[o.idx]
+			for fn, cnt := range o.counts {
+				aggregateCounts[fn] += cnt
+			}
+			aggMetrics.TotalLines += o.m.TotalLines
+			aggMetrics.CodeLines += o.m.CodeLines
+			aggMetrics.CommentLines += o.m.CommentLines
+			aggMetrics.BlankLines += o.m.BlankLines
+			aggMetrics.FileSize += o.m.FileSize
+
+			if jsonOut {
+				if totalFiles > 0 {
+					out.WriteByte(',') //nolint:errcheck
+				}
+				out.WriteString("\n    ") //nolint:errcheck
+				fileResult := StatResult{
 					Language:     langConfig.Name,
-					File:         pf.path,
-					FileSizeKB:   float64(pf.m.FileSize) / 1024,
-					TotalLines:   pf.m.TotalLines,
-					CodeLines:    pf.m.CodeLines,
-					CommentLines: pf.m.CommentLines,
-					BlankLines:   pf.m.BlankLines,
-					Imports:      pf.m.Imports,
-					Decorators:   pf.m.Decorators,
-					UniqueCalls:  len(pf.calls),
-					TopCalls:     toCallEntries(pf.calls, topN),
+					File:         path,
+					FileSizeKB:   float64(o.m.FileSize) / 1024,
+					TotalLines:   o.m.TotalLines,
+					CodeLines:    o.m.CodeLines,
+					CommentLines: o.m.CommentLines,
+					BlankLines:   o.m.BlankLines,
+					Imports:      o.m.Imports,
+					Decorators:   o.m.Decorators,
+					UniqueCalls:  len(o.counts),
+					TopCalls:     topCalls(o.counts, topN),
+				}
+				// Indent to match json.MarshalIndent of the whole document
+				b, _ := json.MarshalIndent(fileResult, "    ", "  ")
+				out.Write(b) //nolint:errcheck
+			} else {
+				fmt.Fprintf(out, "\n%s (%.1f KB, %d lines, %d unique calls)\n",
+					path, float64(o.m.FileSize)/1024, o.m.TotalLines, len(o.counts))
+				for _, c := range topCalls(o.counts, topN) {
+					fmt.Fprintf(out, "  %-23s %d\n", c.Name, c.Count)
 				}
 			}
-			result := DirStatResult{
-				Language:     langConfig.Name,
-				Dir:          dirMode,
-				TotalFiles:   len(collected),
-				TotalLines:   aggMetrics.TotalLines,
-				CodeLines:    aggMetrics.CodeLines,
-				CommentLines: aggMetrics.CommentLines,
-				BlankLines:   aggMetrics.BlankLines,
-				UniqueCalls:  len(aggregateCounts),
-				TopCalls:     toCallEntries(aggCalls, topN),
-				Files:        fileResults,
+			totalFiles++
+		}
+
+		// Deliver in path order: completed results ahead of the next index
+		// wait in pending (bounded by worker skew, each entry already folded
+		// down to metrics plus its call map).
+		pending := make(map[int]statOut, workers)
+		next := 0
+		for r := range results {
+			pending[r.idx] = r
+			for {
+				o, ok := pending[next]
+				if !ok {
+					break
+				}
+				delete(pending, next)
+				emit(o)
+				next++
 			}
-			jsonBytes, _ := json.MarshalIndent(result, "", "  ")
-			fmt.Println(string(jsonBytes))
-			return
 		}
 
-		// Text output: per-file summary + aggregate totals.
-		fmt.Printf("Language: %s  Dir: %s\n", langConfig.Name, dirMode)
-		fmt.Println(strings.Repeat("=", 45))
-		for _, pf := range collected {
-			printCount := len(pf.calls)
-			if topN > 0 && topN < printCount {
-				printCount = topN
+		aggCalls := topCalls(aggregateCounts, topN)
+		if jsonOut {
+			if totalFiles > 0 {
+				out.WriteString("\n  ],\n") //nolint:errcheck
+			} else {
+				out.WriteString("],\n") //nolint:errcheck
 			}
-			fmt.Printf("\n%s (%.1f KB, %d lines, %d unique calls)\n",
-				pf.path, float64(pf.m.FileSize)/1024, pf.m.TotalLines, len(pf.calls))
-			for i := 0; i < printCount; i++ {
-				fmt.Printf("  %-23s %d\n", pf.calls[i].name, pf.calls[i].count)
+			out.WriteString("  \"total_files\": " + strconv.Itoa(totalFiles) + ",\n")                //nolint:errcheck
+			out.WriteString("  \"total_lines\": " + strconv.Itoa(aggMetrics.TotalLines) + ",\n")     //nolint:errcheck
+			out.WriteString("  \"code_lines\": " + strconv.Itoa(aggMetrics.CodeLines) + ",\n")       //nolint:errcheck
+			out.WriteString("  \"comment_lines\": " + strconv.Itoa(aggMetrics.CommentLines) + ",\n") //nolint:errcheck
+			out.WriteString("  \"blank_lines\": " + strconv.Itoa(aggMetrics.BlankLines) + ",\n")     //nolint:errcheck
+			out.WriteString("  \"unique_calls\": " + strconv.Itoa(len(aggregateCounts)) + ",\n")     //nolint:errcheck
+			out.WriteString("  \"top_calls\": ")                                                     //nolint:errcheck
+			b, _ := json.MarshalIndent(aggCalls, "  ", "  ")
+			out.Write(b)             //nolint:errcheck
+			out.WriteString("\n}\n") //nolint:errcheck
+		} else {
+			fmt.Fprintf(out, "\n%s\n", strings.Repeat("=", 45))
+			fmt.Fprintf(out, "TOTAL  files: %d  lines: %d  unique calls: %d\n",
+				totalFiles, aggMetrics.TotalLines, len(aggregateCounts))
+			fmt.Fprintln(out, strings.Repeat("-", 45))
+			for _, c := range aggCalls {
+				fmt.Fprintf(out, "%-25s %d\n", c.Name, c.Count)
 			}
 		}
-		fmt.Printf("\n%s\n", strings.Repeat("=", 45))
-		fmt.Printf("TOTAL  files: %d  lines: %d  unique calls: %d\n",
-			len(collected), aggMetrics.TotalLines, len(aggregateCounts))
-		fmt.Println(strings.Repeat("-", 45))
-		printCount := len(aggCalls)
-		if topN > 0 && topN < printCount {
-			printCount = topN
-		}
-		for i := 0; i < printCount; i++ {
-			fmt.Printf("%-25s %d\n", aggCalls[i].name, aggCalls[i].count)
-		}
+		out.Flush() //nolint:errcheck
 		return
 	}
 
@@ -451,7 +530,7 @@ func main() {
 	}
 
 	callCounts, metrics := analyzeFile(filename, langConfig)
-	calls := sortedCalls(callCounts)
+	calls := topCalls(callCounts, topN)
 
 	if jsonOut {
 		result := StatResult{
@@ -465,12 +544,12 @@ func main() {
 			Imports:      metrics.Imports,
 			Decorators:   metrics.Decorators,
 			UniqueCalls:  len(callCounts),
-			TopCalls:     toCallEntries(calls, topN),
+			TopCalls:     calls,
 		}
 		jsonBytes, _ := json.MarshalIndent(result, "", "  ")
 		fmt.Println(string(jsonBytes))
 		return
 	}
 
-	printFileStats(filename, langConfig.Name, calls, metrics, topN)
+	printFileStats(filename, langConfig.Name, calls, len(callCounts), metrics)
 }
@@ -1,11 +1,10 @@
 package internal
 
 import (
-	"bufio"
-	"os"
 	"regexp"
 	"sort"
 	"strings"
+	"unicode/utf8"
 )
 
 // CallEdge represents a directed call from one function to another.
@@ -39,10 +38,83 @@ type CallGraphResult struct {
 // dropped because RE2 word boundaries are ASCII-only (they never fire before a
 // non-ASCII letter); leftmost-longest matching of the receiver form already
 // prevents a method name from also matching as a separate bare call.
+//
+// The hot path no longer runs this regex: scanCallSites below finds the same
+// candidates in a single pass over the line. The regex is kept as the
+// reference implementation — tests cross-check the scanner against it.
 var ident = identStart + identClass + `*`
 var callIdentRe = regexp.MustCompile(`(` + ident + `)\.(` + ident + `)\s*\(|` +
 	`(` + ident + `)\s*\(`)
 
+// isCallSpace matches RE2's \s between an identifier and its opening paren.
+func isCallSpace(c byte) bool {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r'
+}
+
+// scanCallSites finds call-site candidates in a sanitized line in one pass,
+// yielding (receiver, name) per candidate — receiver is "" for a bare call.
+// It reproduces callIdentRe's leftmost, non-overlapping semantics without the
+// per-line RE2 cost: a dotted chain `a.b.c(` reports receiver b and name c,
+// a matched call resumes scanning after its opening paren, and an identifier
+// run not followed by `(` is skipped whole.
+func scanCallSites(line string, emit func(receiver, name string)) {
+	n := len(line)
+	i := 0
+	for i < n {
+		r, sz := utf8.DecodeRuneInString(line[i:])
+		if !isIdentStartRune(r) {
+			i += sz
+			continue
+		}
+
+		// Consume a dotted identifier chain, keeping the last two segments
+		var prevStart, prevEnd int
+		hasPrev := false
+		curStart := i
+		i += sz
+		for i < n {
+			r, sz = utf8.DecodeRuneInString(line[i:])
+			if !isIdentRune(r) {
+				break
+			}
+			i += sz
+		}
+		curEnd := i
+		for i < n && line[i] == '.' {
+			r, sz = utf8.DecodeRuneInString(line[i+1:])
+			if !isIdentStartRune(r) {
+				break
+			}
+			prevStart, prevEnd, hasPrev = curStart, curEnd, true
+			i++ // the '.'
+			curStart = i
+			i += sz
+			for i < n {
+				r, sz = utf8.DecodeRuneInString(line[i:])
+				if !isIdentRune(r) {
+					break
+				}
+				i += sz
+			}
+			curEnd = i
+		}
+
+		// Optional whitespace, then the opening paren
+		j := i
+		for j < n && isCallSpace(line[j]) {
+			j++
+		}
+		if j < n && line[j] == '(' {
+			if hasPrev {
+				emit(line[prevStart:prevEnd], line[curStart:curEnd])
+			} else {
+				emit("", line[curStart:curEnd])
+			}
+			i = j + 1
+		}
+	}
+}
+
 // BuildFileCallGraph extracts the call graph from a single file.
 //
 // knownFuncs is the set of function names defined in this file (and optionally
@@ -54,28 +126,57 @@ func BuildFileCallGraph(
 	knownFuncs map[string]bool,
 	importAliases map[string]string, // alias → package base name
 ) (*FileCallGraph, error) {
-	// 1. Read all lines
-	lines, err := readAllLines(path)
+	// One shared read+sanitize pass feeds both the function finder and the
+	// call scan below — the file used to be read and sanitized twice here.
+	sanitizer := NewSanitizer(langConfig, false)
+	scan, err := ScanFile(path, sanitizer)
 	if err != nil {
 		return nil, err
 	}
+	defer scan.Release()
 
-	// 2. Map function name → (start, end) from funcfinder
-	finder := CreateFinder(langConfig, "", "map", false, false)
-	fr, err := finder.FindFunctions(path)
-	if err != nil {
-		return nil, err
+	// Map function name → (start, end) from funcfinder
+	var functions []FunctionBounds
+	if langConfig.IndentBased {
+		// The indent-based finder does its own whole-file read and indent
+		// analysis; only brace-based languages share the scan here
+		finder := CreateFinder(langConfig, "", "map", false, false)
+		fr, err := finder.FindFunctions(path)
+		if err != nil {
+			return nil, err
+		}
+		functions = fr.Functions
+	} else {
+		finder := NewFinder(langConfig, nil, true, false, false)
+		fr, err := finder.FindFunctionsScanned(scan)
+		if err != nil {
+			return nil, err
+		}
+		functions = fr.Functions
 	}
 
-	// Build a combined known set: file-local functions + provided knownFuncs
-	localFuncs := make(map[string]bool, len(fr.Functions)+len(knownFuncs))
-	for _, f := range fr.Functions {
-		localFuncs[f.Name] = true
-	}
-	for k := range knownFuncs {
-		localFuncs[k] = true
-	}
+	return buildCallGraphFromScan(scan, functions, knownFuncs, importAliases), nil
+}
 
+// fileCallData is the extraction result for one file, independent of the
+// directory-wide function set: dotted calls are already resolved through the
+// file's own import aliases, bare calls keep the raw candidate name in Callee
+// and are resolved against a function set later. Because it depends only on
+// the file's content, it can be persisted keyed by checksum (callgraphstore.go)
+// and reused while other files change.
+type fileCallData struct {
+	Dotted []CallEdge `json:"dotted,omitempty"`
+	Bare   []CallEdge `json:"bare,omitempty"`
+}
+
+// extractFileCalls scans the sanitized lines for call-site candidates, given
+// the function bounds found in the scan. Edge strings are built from the
+// cleaned lines, so the result stays valid after the scan is released.
+func extractFileCalls(
+	scan *FileScan,
+	functions []FunctionBounds,
+	importAliases map[string]string,
+) fileCallData {
 	// Build line → caller name index
 	type funcRange struct {
 		name  string
@@ -83,7 +184,7 @@ func BuildFileCallGraph(
 		end   int
 	}
 	var ranges []funcRange
-	for _, f := range fr.Functions {
+	for _, f := range functions {
 		ranges = append(ranges, funcRange{f.Name, f.Start, f.End})
 	}
 	sort.Slice(ranges, func(i, j int) bool { return ranges[i].start < ranges[j].start })
@@ -97,56 +198,58 @@ func BuildFileCallGraph(
 		return ""
 	}
 
-	// 3. Sanitize and scan for calls
-	sanitizer := NewSanitizer(langConfig, false)
-	state := StateNormal
-
-	cgFile := &FileCallGraph{Path: path}
+	var data fileCallData
 	seen := make(map[string]bool)
 
-	for i, raw := range lines {
+	for i, clean := range scan.Cleaned {
 		lineNo := i + 1
-		clean, newState := sanitizer.CleanLine(raw, state)
-		state = newState
 
 		caller := callerAt(lineNo)
 		if caller == "" {
 			continue // outside any known function
 		}
 
-		matches := callIdentRe.FindAllStringSubmatch(clean, -1)
-		for _, m := range matches {
+		scanCallSites(clean, func(receiver, fname string) {
 			var callee string
-			if m[1] != "" && m[2] != "" {
+			if receiver != "" {
 				// pkg.Func( form
-				receiver := m[1]
-				fname := m[2]
 				if pkg, ok := importAliases[receiver]; ok {
 					callee = pkg + "." + fname
 				} else {
 					callee = receiver + "." + fname
 				}
-			} else if m[3] != "" {
-				// bare Func( form
-				fname := m[3]
-				if !localFuncs[fname] {
-					continue // not a known function → skip
-				}
+			} else {
+				// bare Func( form — resolved later against the function set
 				callee = fname
 			}
-			if callee == "" || callee == caller {
-				continue
+			if callee == caller {
+				return
 			}
 			key := caller + "→" + callee
 			if seen[key] {
-				continue
+				return
 			}
 			seen[key] = true
-			cgFile.Calls = append(cgFile.Calls, CallEdge{
-				Caller: caller,
-				Callee: callee,
-				Line:   lineNo,
-			})
+			edge := CallEdge{Caller: caller, Callee: callee, Line: lineNo}
+			if receiver != "" {
+				data.Dotted = append(data.Dotted, edge)
+			} else {
+				data.Bare = append(data.Bare, edge)
+			}
+		})
+	}
+	return data
+}
+
+// resolveFileCalls turns extracted call data into the final per-file graph:
+// dotted edges pass through, bare candidates are kept only when their name is
+// in funcSet.
+func resolveFileCalls(path string, data fileCallData, funcSet map[string]bool) *FileCallGraph {
+	cgFile := &FileCallGraph{Path: path}
+	cgFile.Calls = append(cgFile.Calls, data.Dotted...)
+	for _, e := range data.Bare {
+		if funcSet[e.Callee] {
+			cgFile.Calls = append(cgFile.Calls, e)
 		}
 	}
 
@@ -156,8 +259,28 @@ func BuildFileCallGraph(
 		}
 		return cgFile.Calls[i].Callee < cgFile.Calls[j].Callee
 	})
+	return cgFile
+}
 
-	return cgFile, nil
+// buildCallGraphFromScan extracts call edges from an already sanitized scan,
+// given the function bounds found in it.
+func buildCallGraphFromScan(
+	scan *FileScan,
+	functions []FunctionBounds,
+	knownFuncs map[string]bool,
+	importAliases map[string]string,
+) *FileCallGraph {
+	// Build a combined known set: file-local functions + provided knownFuncs
+	localFuncs := make(map[string]bool, len(functions)+len(knownFuncs))
+	for _, f := range functions {
+		localFuncs[f.Name] = true
+	}
+	for k := range knownFuncs {
+		localFuncs[k] = true
+	}
+
+	data := extractFileCalls(scan, functions, importAliases)
+	return resolveFileCalls(scan.Path, data, localFuncs)
 }
 
 // BuildDirCallGraph processes all files in results and builds the call graph.
@@ -178,6 +301,9 @@ func BuildDirCallGraph(
 	cg := &CallGraphResult{}
 	cg.TotalFunctions = len(globalFuncs)
 
+	// The directory results already carry every file's function bounds, so
+	// each file needs exactly one read+sanitize pass here — the finder is not
+	// re-run per file.
 	for _, r := range results {
 		if len(r.Functions) == 0 {
 			continue
@@ -187,8 +313,16 @@ func BuildDirCallGraph(
 			continue
 		}
 		aliases := importsByFile[r.Path]
-		fcg, err := BuildFileCallGraph(r.Path, langConfig, globalFuncs, aliases)
-		if err != nil || len(fcg.Calls) == 0 {
+
+		sanitizer := NewSanitizer(langConfig, false)
+		scan, err := ScanFile(r.Path, sanitizer)
+		if err != nil {
+			continue
+		}
+		fcg := buildCallGraphFromScan(scan, r.Functions, globalFuncs, aliases)
+		scan.Release()
+
+		if len(fcg.Calls) == 0 {
 			continue
 		}
 		cg.Files = append(cg.Files, *fcg)
@@ -225,18 +359,3 @@ func FormatCallGraphText(cg *CallGraphResult) string {
 	}
 	return strings.TrimRight(sb.String(), "\n")
 }
-
-// readAllLines reads a file and returns all lines (without newline characters).
-func readAllLines(path string) ([]string, error) {
-	f, err := os.Open(path)
-	if err != nil {
-		return nil, err
-	}
-	defer f.Close()
-	var lines []string
-	sc := bufio.NewScanner(f)
-	for sc.Scan() {
-		lines = append(lines, sc.Text())
-	}
-	return lines, sc.Err()
-}
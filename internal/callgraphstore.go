@@ -0,0 +1,169 @@
+// callgraphstore.go - Persistent per-file call-graph store for cmd/callgraph.
+//
+// BuildDirCallGraph re-reads and re-sanitizes every file on every run even
+// though call edges only change in modified files. The store persists each
+// file's extracted calls keyed by its checksum (the same machinery as
+// resultcache.go uses for function bounds): an incremental run re-extracts
+// only changed files, splices the stored data for the rest, and resolves bare
+// calls against the merged function set — so caller-of queries in hooks stay
+// well under a second instead of paying for a full rebuild.
+package internal
+
+import (
+	"encoding/json"
+	"os"
+)
+
+// CallGraphStoreFile is the default on-disk location of the call-graph store,
+// relative to the working directory (alongside .funcfinder-cache).
+const CallGraphStoreFile = ".funcfinder-callgraph"
+
+// callGraphStoreEntry holds the extracted call data for one file. Bare
+// candidates are stored unresolved (fileCallData), so the entry stays valid
+// when functions are added or removed in other files.
+type callGraphStoreEntry struct {
+	Checksum string       `json:"checksum"`
+	Calls    fileCallData `json:"calls"`
+}
+
+// CallGraphStore maps file paths to their last extracted call data. Unlike
+// ResultCache it is only touched from the serial merge loop, so no locking.
+type CallGraphStore struct {
+	path    string
+	entries map[string]callGraphStoreEntry
+	dirty   bool
+}
+
+// LoadCallGraphStore loads the store from path. A missing or unreadable file
+// yields an empty store — the store is an optimization, never a hard error.
+func LoadCallGraphStore(path string) *CallGraphStore {
+	s := &CallGraphStore{
+		path:    path,
+		entries: make(map[string]callGraphStoreEntry),
+	}
+
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return s
+	}
+	// A corrupt store is silently dropped and rebuilt on Save.
+	json.Unmarshal(data, &s.entries) //nolint:errcheck
+	return s
+}
+
+// lookup returns the stored call data for filePath if its checksum matches.
+func (s *CallGraphStore) lookup(filePath, checksum string) (fileCallData, bool) {
+	entry, ok := s.entries[filePath]
+	if !ok || entry.Checksum != checksum {
+		return fileCallData{}, false
+	}
+	return entry.Calls, true
+}
+
+// store records the extracted call data for filePath under the given checksum.
+func (s *CallGraphStore) store(filePath, checksum string, data fileCallData) {
+	s.entries[filePath] = callGraphStoreEntry{Checksum: checksum, Calls: data}
+	s.dirty = true
+}
+
+// prune drops entries for files that no longer exist in the scanned set, so
+// edges from deleted files do not linger in the merged graph.
+func (s *CallGraphStore) prune(live map[string]bool) {
+	for path := range s.entries {
+		if !live[path] {
+			delete(s.entries, path)
+			s.dirty = true
+		}
+	}
+}
+
+// Save writes the store back to disk if anything changed since loading.
+func (s *CallGraphStore) Save() error {
+	if !s.dirty {
+		return nil
+	}
+	data, err := json.Marshal(s.entries)
+	if err != nil {
+		return err
+	}
+	if err := os.WriteFile(s.path, data, 0644); err != nil {
+		return err
+	}
+	s.dirty = false
+	return nil
+}
+
+// Len returns the number of stored files.
+func (s *CallGraphStore) Len() int {
+	return len(s.entries)
+}
+
+// BuildDirCallGraphIncremental is BuildDirCallGraph backed by a persistent
+// store: files whose checksum matches the stored entry are not re-read at all,
+// only changed files go through the sanitize+extract pass. importsFor is
+// called lazily so unchanged files skip the import scan too. Bare calls are
+// resolved against the current directory-wide function set on every run, so
+// adding or deleting a function elsewhere still updates edges in unchanged
+// files.
+func BuildDirCallGraphIncremental(
+	results []DirResult,
+	config Config,
+	importsFor func(path string) map[string]string,
+	store *CallGraphStore,
+) *CallGraphResult {
+	// Global function name set (all functions in the dir)
+	globalFuncs := make(map[string]bool)
+	for _, r := range results {
+		for _, f := range r.Functions {
+			globalFuncs[f.Name] = true
+		}
+	}
+
+	cg := &CallGraphResult{}
+	cg.TotalFunctions = len(globalFuncs)
+
+	live := make(map[string]bool, len(results))
+	reused := 0
+	for _, r := range results {
+		live[r.Path] = true
+		if len(r.Functions) == 0 {
+			continue
+		}
+		langConfig := config.GetLanguageByExtension(r.Path)
+		if langConfig == nil {
+			continue
+		}
+
+		checksum, err := computeFileChecksum(r.Path)
+		if err != nil {
+			continue
+		}
+
+		data, ok := store.lookup(r.Path, checksum)
+		if ok {
+			reused++
+		} else {
+			sanitizer := NewSanitizer(langConfig, false)
+			scan, err := ScanFile(r.Path, sanitizer)
+			if err != nil {
+				continue
+			}
+			data = extractFileCalls(scan, r.Functions, importsFor(r.Path))
+			scan.Release()
+			store.store(r.Path, checksum, data)
+		}
+
+		fcg := resolveFileCalls(r.Path, data, globalFuncs)
+		if len(fcg.Calls) == 0 {
+			continue
+		}
+		cg.Files = append(cg.Files, *fcg)
+		cg.TotalCalls += len(fcg.Calls)
+	}
+
+	store.prune(live)
+	if reused > 0 {
+		InfoMessage("Call-graph store: reused %d of %d files", reused, len(results))
+	}
+	return cg
+}
@@ -0,0 +1,143 @@
+package internal
+
+import (
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"reflect"
+	"testing"
+)
+
+// TestBuildDirCallGraphIncremental_MatchesFullBuild: холодный и тёплый запуск
+// через store должны давать ровно тот же граф, что и полная пересборка.
+func TestBuildDirCallGraphIncremental_MatchesFullBuild(t *testing.T) {
+	tmpDir := t.TempDir()
+	aPath := filepath.Join(tmpDir, "a.go")
+	bPath := filepath.Join(tmpDir, "b.go")
+	mustWrite(t, aPath, "package main\n\nfunc Caller() {\n\tCallee()\n\tfmt.Println(1)\n}\n")
+	mustWrite(t, bPath, "package main\n\nfunc Callee() {\n\tHelper()\n}\n\nfunc Helper() {}\n")
+
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	dp := NewDirProcessor(config, 1, true, false, "functions")
+	results, err := dp.ProcessDirectory(tmpDir)
+	if err != nil {
+		t.Fatalf("ProcessDirectory() error = %v", err)
+	}
+
+	full := BuildDirCallGraph(results, config, nil)
+
+	storePath := filepath.Join(tmpDir, CallGraphStoreFile)
+	noImports := func(path string) map[string]string { return nil }
+
+	// Холодный запуск: store пуст, всё извлекается заново
+	store := LoadCallGraphStore(storePath)
+	cold := BuildDirCallGraphIncremental(results, config, noImports, store)
+	if !reflect.DeepEqual(full, cold) {
+		t.Errorf("cold incremental build differs from full build:\nfull %+v\ncold %+v", full, cold)
+	}
+	if err := store.Save(); err != nil {
+		t.Fatalf("Save() error = %v", err)
+	}
+
+	// Тёплый запуск: все файлы без изменений, граф собирается из store
+	store = LoadCallGraphStore(storePath)
+	if store.Len() != 2 {
+		t.Fatalf("store has %d entries after save/load, want 2", store.Len())
+	}
+	warm := BuildDirCallGraphIncremental(results, config, noImports, store)
+	if !reflect.DeepEqual(full, warm) {
+		t.Errorf("warm incremental build differs from full build:\nfull %+v\nwarm %+v", full, warm)
+	}
+}
+
+// TestBuildDirCallGraphIncremental_ResolvesAgainstCurrentFuncs: bare-вызовы
+// хранятся неразрешёнными, поэтому удаление функции в другом файле убирает
+// ребро из неизменённого файла при следующем слиянии.
+func TestBuildDirCallGraphIncremental_ResolvesAgainstCurrentFuncs(t *testing.T) {
+	tmpDir := t.TempDir()
+	aPath := filepath.Join(tmpDir, "a.go")
+	bPath := filepath.Join(tmpDir, "b.go")
+	mustWrite(t, aPath, "package main\n\nfunc Caller() {\n\tCallee()\n}\n")
+	mustWrite(t, bPath, "package main\n\nfunc Callee() {}\n")
+
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	storePath := filepath.Join(tmpDir, CallGraphStoreFile)
+	noImports := func(path string) map[string]string { return nil }
+
+	dp := NewDirProcessor(config, 1, true, false, "functions")
+	results, err := dp.ProcessDirectory(tmpDir)
+	if err != nil {
+		t.Fatalf("ProcessDirectory() error = %v", err)
+	}
+	store := LoadCallGraphStore(storePath)
+	cg := BuildDirCallGraphIncremental(results, config, noImports, store)
+	if cg.TotalCalls != 1 {
+		t.Fatalf("TotalCalls = %d, want 1 before deletion", cg.TotalCalls)
+	}
+
+	// Callee удаляется из b.go; a.go не меняется и берётся из store
+	mustWrite(t, bPath, "package main\n\nfunc Other() {}\n")
+	results, err = dp.ProcessDirectory(tmpDir)
+	if err != nil {
+		t.Fatalf("ProcessDirectory() error = %v", err)
+	}
+	cg = BuildDirCallGraphIncremental(results, config, noImports, store)
+	if cg.TotalCalls != 0 {
+		t.Errorf("TotalCalls = %d after deleting Callee, want 0 (stale edge from stored a.go)", cg.TotalCalls)
+	}
+}
+
+// TestCallGraphStore_PrunesDeletedFiles: записи удалённых файлов вычищаются
+// при слиянии и не переживают Save.
+func TestCallGraphStore_PrunesDeletedFiles(t *testing.T) {
+	store := LoadCallGraphStore(filepath.Join(t.TempDir(), CallGraphStoreFile))
+	store.store("gone.go", "deadbeef", fileCallData{Bare: []CallEdge{{Caller: "A", Callee: "B", Line: 1}}})
+	store.store("kept.go", "cafebabe", fileCallData{})
+
+	store.prune(map[string]bool{"kept.go": true})
+	if store.Len() != 1 {
+		t.Fatalf("store has %d entries after prune, want 1", store.Len())
+	}
+	if _, ok := store.lookup("gone.go", "deadbeef"); ok {
+		t.Error("pruned entry still resolvable")
+	}
+	if _, ok := store.lookup("kept.go", "cafebabe"); !ok {
+		t.Error("surviving entry lost during prune")
+	}
+}
+
+// TestCallGraphStore_CorruptFileIsDropped: битый store не ошибка — он просто
+// заменяется пустым, как и ResultCache.
+func TestCallGraphStore_CorruptFileIsDropped(t *testing.T) {
+	path := filepath.Join(t.TempDir(), CallGraphStoreFile)
+	mustWrite(t, path, "{not json")
+
+	store := LoadCallGraphStore(path)
+	if store.Len() != 0 {
+		t.Errorf("corrupt store loaded %d entries, want 0", store.Len())
+	}
+
+	store.store("a.go", "feed", fileCallData{})
+	if err := store.Save(); err != nil {
+		t.Fatalf("Save() over corrupt file error = %v", err)
+	}
+	reloaded := LoadCallGraphStore(path)
+	if reloaded.Len() != 1 {
+		t.Errorf("rebuilt store has %d entries, want 1", reloaded.Len())
+	}
+	// Сохранённый файл должен быть валидным JSON
+	data := map[string]callGraphStoreEntry{}
+	raw, err := os.ReadFile(path)
+	if err != nil {
+		t.Fatalf("reading saved store: %v", err)
+	}
+	if err := json.Unmarshal(raw, &data); err != nil {
+		t.Errorf("saved store is not valid JSON: %v", err)
+	}
+}
@@ -0,0 +1,57 @@
+package internal
+
+import (
+	"fmt"
+	"testing"
+)
+
+// TestScanCallSites_MatchesReferenceRegex cross-checks the single-pass
+// call-site scanner against callIdentRe, the reference implementation it
+// replaced on the hot path: same candidates, same order, same receiver/name
+// split, same non-overlap behavior.
+func TestScanCallSites_MatchesReferenceRegex(t *testing.T) {
+	lines := []string{
+		`foo()`,
+		`pkg.Func(x, y)`,
+		`a.b.c(1)`,
+		`result := helper (arg)`,
+		`x := 123(`,
+		`obj.method().chained(next)`,
+		`f(g(h(x)))`,
+		`if cond { doIt() } else { other.thing() }`,
+		`Привет(мир)`,
+		`пакет.Функция()`,
+		`no calls on this line at all`,
+		`almost.a.call but not (quite)`,
+		`weird..double(dots)`,
+		`trailing.dot.(assert)`,
+		`a1.b2(c3())`,
+		``,
+		`   ()`,
+		`_underscore(ok)`,
+	}
+
+	for _, line := range lines {
+		var want []string
+		for _, m := range callIdentRe.FindAllStringSubmatch(line, -1) {
+			if m[1] != "" && m[2] != "" {
+				want = append(want, m[1]+"."+m[2])
+			} else if m[3] != "" {
+				want = append(want, m[3])
+			}
+		}
+
+		var got []string
+		scanCallSites(line, func(receiver, name string) {
+			if receiver != "" {
+				got = append(got, receiver+"."+name)
+			} else {
+				got = append(got, name)
+			}
+		})
+
+		if fmt.Sprint(got) != fmt.Sprint(want) {
+			t.Errorf("scanCallSites(%q) = %v, regex reference = %v", line, got, want)
+		}
+	}
+}
@@ -9,11 +9,21 @@ import (
 	"path/filepath"
 	"regexp"
 	"sort"
+	"sync"
+	"sync/atomic"
 )
 
+//go:generate go run gen_languages.go
+
 //go:embed languages.json
 var languagesFS embed.FS
 
+// builtinConfig is populated by the init function in the generated
+// languages_gen.go (see gen_languages.go). When present, LoadConfig returns
+// it directly: no JSON parsing and no regex compilation at startup — regexes
+// compile lazily per language on first use.
+var builtinConfig Config
+
 // StructTypePattern represents a pattern for a specific type kind
 type StructTypePattern struct {
 	Type    string `json:"type"`   // Type kind: class, struct, interface, enum, etc.
@@ -65,15 +75,120 @@ type LanguageConfig struct {
 	// Extra patterns for specialized finders (structfinder, etc.)
 	ExtraPatterns map[string]string `json:"extra_patterns,omitempty"`
 
-	// Compiled regex cache
-	funcRegex       *regexp.Regexp
-	classRegex      *regexp.Regexp
-	structPatterns  map[string]*regexp.Regexp
-	fieldRegex      *regexp.Regexp
-	callRegex       *regexp.Regexp
-	importRegex     *regexp.Regexp
-	decoratorRe     *regexp.Regexp
-	blockCommentRe  *regexp.Regexp
+	// Compiled regex cache, filled lazily by ensureCompiled on first getter
+	// use (compiled is a plain flag rather than a sync.Once so the struct
+	// stays copyable during config loading)
+	compiled       uint32
+	compileErr     error
+	funcRegex      *regexp.Regexp
+	funcLiteral    string // mandatory literal of FuncPattern ("" = none)
+	classRegex     *regexp.Regexp
+	classLiteral   string // mandatory literal of ClassPattern ("" = none)
+	structPatterns map[string]*regexp.Regexp
+	fieldRegex     *regexp.Regexp
+	fieldLiteral   string // mandatory literal of FieldPattern ("" = none)
+	callRegex      *regexp.Regexp
+	importRegex    *regexp.Regexp
+	decoratorRe    *regexp.Regexp
+	blockCommentRe *regexp.Regexp
+}
+
+// compileMu serialises lazy compilation; compilation happens at most once per
+// language per process, so a single package-level mutex is not contended.
+var compileMu sync.Mutex
+
+// ensureCompiled compiles all the language's patterns exactly once. Safe for
+// concurrent use by the directory-mode worker pool.
+func (lc *LanguageConfig) ensureCompiled() {
+	if atomic.LoadUint32(&lc.compiled) == 1 {
+		return
+	}
+	compileMu.Lock()
+	defer compileMu.Unlock()
+	if lc.compiled == 1 {
+		return
+	}
+	lc.compileErr = lc.compilePatterns()
+	atomic.StoreUint32(&lc.compiled, 1)
+}
+
+// compilePatterns compiles every configured pattern into the regex cache.
+func (lc *LanguageConfig) compilePatterns() error {
+	lc.structPatterns = make(map[string]*regexp.Regexp, len(lc.StructTypePatterns))
+	for _, sp := range lc.StructTypePatterns {
+		re, err := regexp.Compile(expandIdentPlaceholder(sp.Pattern))
+		if err != nil {
+			return fmt.Errorf("invalid struct pattern (%s): %w", sp.Type, err)
+		}
+		lc.structPatterns[sp.Type] = re
+	}
+
+	if lc.FuncPattern != "" {
+		expanded := expandIdentPlaceholder(lc.FuncPattern)
+		re, err := regexp.Compile(expanded)
+		if err != nil {
+			return fmt.Errorf("invalid func regex: %w", err)
+		}
+		lc.funcRegex = re
+		lc.funcLiteral = requiredLiteral(expanded)
+	}
+
+	if lc.ClassPattern != "" {
+		expanded := expandIdentPlaceholder(lc.ClassPattern)
+		re, err := regexp.Compile(expanded)
+		if err != nil {
+			return fmt.Errorf("invalid class regex: %w", err)
+		}
+		lc.classRegex = re
+		lc.classLiteral = requiredLiteral(expanded)
+	}
+
+	if lc.FieldPattern != "" {
+		expanded := expandIdentPlaceholder(lc.FieldPattern)
+		re, err := regexp.Compile(expanded)
+		if err != nil {
+			return fmt.Errorf("invalid field pattern: %w", err)
+		}
+		lc.fieldRegex = re
+		lc.fieldLiteral = requiredLiteral(expanded)
+	}
+
+	if lc.CallPattern != "" {
+		re, err := regexp.Compile(expandIdentPlaceholder(lc.CallPattern))
+		if err != nil {
+			return fmt.Errorf("invalid call regex: %w", err)
+		}
+		lc.callRegex = re
+	}
+
+	if lc.ImportPattern != "" {
+		re, err := regexp.Compile(lc.ImportPattern)
+		if err != nil {
+			return fmt.Errorf("invalid import regex: %w", err)
+		}
+		lc.importRegex = re
+	}
+
+	if lc.DecoratorPattern != "" {
+		re, err := regexp.Compile(lc.DecoratorPattern)
+		if err != nil {
+			return fmt.Errorf("invalid decorator regex: %w", err)
+		}
+		lc.decoratorRe = re
+	}
+
+	if lc.BlockCommentStart != "" && lc.BlockCommentEnd != "" {
+		// Use regexp.QuoteMeta to escape special regex characters like /* and */
+		start := regexp.QuoteMeta(lc.BlockCommentStart)
+		end := regexp.QuoteMeta(lc.BlockCommentEnd)
+		re, err := regexp.Compile(fmt.Sprintf(`%s[\s\S]*?%s`, start, end))
+		if err != nil {
+			return fmt.Errorf("invalid block comment regex: %w", err)
+		}
+		lc.blockCommentRe = re
+	}
+
+	return nil
 }
 
 // Config is a map of language keys to their configurations
@@ -86,8 +201,22 @@ type LanguageConfigWithMap struct {
 	StructTypePatternsMap map[string]string `json:"struct_type_patterns,omitempty"`
 }
 
-// LoadConfig loads language configurations from embedded JSON
+// LoadConfig returns the language configurations. With the generated
+// languages_gen.go present this is a map lookup away from free: the configs
+// are package-level Go declarations and each language's regexes compile
+// lazily on first use. The embedded JSON remains as a fallback (and as the
+// source of truth for go generate).
 func LoadConfig() (Config, error) {
+	if builtinConfig != nil {
+		return builtinConfig, nil
+	}
+	return loadConfigFromJSON()
+}
+
+// loadConfigFromJSON parses the embedded languages.json and eagerly validates
+// every pattern. Only used when the generated config is absent, and by tests
+// that pin the generated code to the JSON.
+func loadConfigFromJSON() (Config, error) {
 	data, err := languagesFS.ReadFile("languages.json")
 	if err != nil {
 		return nil, fmt.Errorf("failed to read languages.json: %w", err)
@@ -105,14 +234,19 @@ func LoadConfig() (Config, error) {
 		// Convert LanguageConfigWithMap to LanguageConfig
 		conf := langConf.LanguageConfig
 
-		// Convert struct_type_patterns map to compiled regexes
-		conf.structPatterns = make(map[string]*regexp.Regexp)
-		for typeKind, pattern := range langConf.StructTypePatternsMap {
-			re, err := regexp.Compile(expandIdentPlaceholder(pattern))
-			if err != nil {
-				return nil, fmt.Errorf("invalid struct pattern for %s (%s): %w", lang, typeKind, err)
-			}
-			conf.structPatterns[typeKind] = re
+		// Normalise struct_type_patterns from JSON-object to a sorted slice;
+		// compilePatterns builds the regex map from it.
+		kinds := make([]string, 0, len(langConf.StructTypePatternsMap))
+		for typeKind := range langConf.StructTypePatternsMap {
+			kinds = append(kinds, typeKind)
+		}
+		sort.Strings(kinds)
+		conf.StructTypePatterns = conf.StructTypePatterns[:0]
+		for _, typeKind := range kinds {
+			conf.StructTypePatterns = append(conf.StructTypePatterns, StructTypePattern{
+				Type:    typeKind,
+				Pattern: langConf.StructTypePatternsMap[typeKind],
+			})
 		}
 
 		// Set LangKey if not provided
@@ -120,71 +254,11 @@ func LoadConfig() (Config, error) {
 			conf.LangKey = lang
 		}
 
-		// Compile function regex
-		if conf.FuncPattern != "" {
-			re, err := regexp.Compile(expandIdentPlaceholder(conf.FuncPattern))
-			if err != nil {
-				return nil, fmt.Errorf("invalid func regex for %s: %w", lang, err)
-			}
-			conf.funcRegex = re
-		}
-
-		// Compile class regex if specified
-		if conf.ClassPattern != "" {
-			classRe, err := regexp.Compile(expandIdentPlaceholder(conf.ClassPattern))
-			if err != nil {
-				return nil, fmt.Errorf("invalid class regex for %s: %w", lang, err)
-			}
-			conf.classRegex = classRe
-		}
-
-		// Compile field pattern if specified
-		if conf.FieldPattern != "" {
-			fieldRe, err := regexp.Compile(expandIdentPlaceholder(conf.FieldPattern))
-			if err != nil {
-				return nil, fmt.Errorf("invalid field pattern for %s: %w", lang, err)
-			}
-			conf.fieldRegex = fieldRe
-		}
-
-		// Compile call regex if specified
-		if conf.CallPattern != "" {
-			callRe, err := regexp.Compile(expandIdentPlaceholder(conf.CallPattern))
-			if err != nil {
-				return nil, fmt.Errorf("invalid call regex for %s: %w", lang, err)
-			}
-			conf.callRegex = callRe
-		}
-
-		// Compile import regex if specified
-		if conf.ImportPattern != "" {
-			importRe, err := regexp.Compile(conf.ImportPattern)
-			if err != nil {
-				return nil, fmt.Errorf("invalid import regex for %s: %w", lang, err)
-			}
-			conf.importRegex = importRe
-		}
-
-		// Compile decorator regex if specified
-		if conf.DecoratorPattern != "" {
-			decoratorRe, err := regexp.Compile(conf.DecoratorPattern)
-			if err != nil {
-				return nil, fmt.Errorf("invalid decorator regex for %s: %w", lang, err)
-			}
-			conf.decoratorRe = decoratorRe
-		}
-
-		// Compile block comment regex if specified
-		if conf.BlockCommentStart != "" && conf.BlockCommentEnd != "" {
-			// Use regexp.QuoteMeta to escape special regex characters like /* and */
-			start := regexp.QuoteMeta(conf.BlockCommentStart)
-			end := regexp.QuoteMeta(conf.BlockCommentEnd)
-			pattern := fmt.Sprintf(`%s[\s\S]*?%s`, start, end)
-			blockRe, err := regexp.Compile(pattern)
-			if err != nil {
-				return nil, fmt.Errorf("invalid block comment regex for %s: %w", lang, err)
-			}
-			conf.blockCommentRe = blockRe
+		// Validate all patterns up front — a broken languages.json should
+		// fail at load, not at first use deep inside a scan.
+		conf.ensureCompiled()
+		if conf.compileErr != nil {
+			return nil, fmt.Errorf("%s: %w", lang, conf.compileErr)
 		}
 
 		config[lang] = &conf
@@ -226,15 +300,34 @@ func (c Config) GetSupportedLanguages() []string {
 	return languages
 }
 
-// Regex getters for funcfinder
+// Regex getters for funcfinder. Each getter triggers the lazy one-time
+// compile for this language; a pattern that fails to compile behaves as
+// "not configured" (nil), which can only happen with a hand-edited
+// generated config — go generate validates every pattern.
 func (lc *LanguageConfig) FuncRegex() *regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.funcRegex
 }
 
 func (lc *LanguageConfig) ClassRegex() *regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.classRegex
 }
 
+// FuncLiteral returns a literal substring every FuncRegex match must contain,
+// or "" when the pattern has no provable literal. Callers use it as a cheap
+// strings.Contains prefilter so RE2 only runs on candidate lines.
+func (lc *LanguageConfig) FuncLiteral() string {
+	lc.ensureCompiled()
+	return lc.funcLiteral
+}
+
+// ClassLiteral is the ClassRegex counterpart of FuncLiteral.
+func (lc *LanguageConfig) ClassLiteral() string {
+	lc.ensureCompiled()
+	return lc.classLiteral
+}
+
 // GetExtraPattern returns an extra pattern by key
 func (lc *LanguageConfig) GetExtraPattern(key string) string {
 	if lc.ExtraPatterns != nil {
@@ -251,11 +344,13 @@ func (lc *LanguageConfig) HasClasses() bool {
 
 // GetStructPatterns returns all compiled struct type patterns
 func (lc *LanguageConfig) GetStructPatterns() map[string]*regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.structPatterns
 }
 
 // GetStructPattern returns a compiled pattern for a specific struct type
 func (lc *LanguageConfig) GetStructPattern(typeKind string) *regexp.Regexp {
+	lc.ensureCompiled()
 	if lc.structPatterns != nil {
 		return lc.structPatterns[typeKind]
 	}
@@ -264,28 +359,40 @@ func (lc *LanguageConfig) GetStructPattern(typeKind string) *regexp.Regexp {
 
 // GetFieldPattern returns the compiled field pattern regex
 func (lc *LanguageConfig) GetFieldPattern() *regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.fieldRegex
 }
 
-// HasStructSupport returns true if the language has struct type patterns configured
+// FieldLiteral is the FieldPattern counterpart of FuncLiteral.
+func (lc *LanguageConfig) FieldLiteral() string {
+	lc.ensureCompiled()
+	return lc.fieldLiteral
+}
+
+// HasStructSupport returns true if the language has struct type patterns
+// configured. Checked against the raw patterns so it never forces a compile.
 func (lc *LanguageConfig) HasStructSupport() bool {
-	return len(lc.structPatterns) > 0
+	return len(lc.StructTypePatterns) > 0
 }
 
 // Regex getters for stat.go
 func (lc *LanguageConfig) CallRegex() *regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.callRegex
 }
 
 func (lc *LanguageConfig) DecoratorRegex() *regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.decoratorRe
 }
 
 // Regex getters for deps.go
 func (lc *LanguageConfig) ImportRegex() *regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.importRegex
 }
 
 func (lc *LanguageConfig) BlockCommentRegex() *regexp.Regexp {
+	lc.ensureCompiled()
 	return lc.blockCommentRe
 }
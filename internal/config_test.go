@@ -30,7 +30,8 @@ func TestLoadConfig_AllLanguagesHaveRegex(t *testing.T) {
 	}
 
 	for lang, langConfig := range config {
-		if langConfig.funcRegex == nil {
+		// FuncRegex triggers the lazy per-language compile
+		if langConfig.FuncRegex() == nil {
 			t.Errorf("Language %s has nil funcRegex", lang)
 		}
 	}
@@ -132,9 +133,9 @@ func TestLoadConfig_LanguageConfigurations(t *testing.T) {
 				t.Error("FuncPattern is empty")
 			}
 
-			// Verify regex is compiled
-			if langConfig.funcRegex == nil {
-				t.Error("funcRegex is nil (not compiled)")
+			// Verify regex compiles on first use
+			if langConfig.FuncRegex() == nil {
+				t.Error("funcRegex is nil (did not compile)")
 			}
 		})
 	}
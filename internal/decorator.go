@@ -84,23 +84,41 @@ func (dw *DecoratorWindow) Clear() {
 	dw.lineNumbers = dw.lineNumbers[:0]
 }
 
-// GetIndentLevel возвращает уровень отступа строки (количество пробелов в начале)
+// GetIndentLevel возвращает уровень отступа строки (количество пробелов в начале).
+// Отступ состоит только из ASCII-пробелов и табов, поэтому достаточно
+// побайтового прохода без декодирования рун.
 func GetIndentLevel(line string) int {
 	indent := 0
-	for _, ch := range line {
-		if ch == ' ' {
+	for i := 0; i < len(line); i++ {
+		switch line[i] {
+		case ' ':
 			indent++
-		} else if ch == '\t' {
+		case '\t':
 			indent += 4 // считаем табуляцию как 4 пробела
-		} else {
-			break
+		default:
+			return indent
 		}
 	}
 	return indent
 }
 
-// IsEmptyOrComment проверяет, является ли строка пустой или комментарием
+// IsEmptyOrComment проверяет, является ли строка пустой или комментарием.
+// Обычный случай (ASCII-отступ) решается побайтово; строки с юникодными
+// пробелами уходят в общий путь через TrimSpace.
 func IsEmptyOrComment(line string, commentPrefix string) bool {
-	trimmed := strings.TrimSpace(line)
-	return trimmed == "" || strings.HasPrefix(trimmed, commentPrefix)
+	i := 0
+	for i < len(line) {
+		c := line[i]
+		if c == ' ' || c == '\t' || c == '\r' {
+			i++
+			continue
+		}
+		if c >= 0x80 || c == '\v' || c == '\f' {
+			// Нестандартный пробельный символ — медленный общий путь
+			trimmed := strings.TrimSpace(line)
+			return trimmed == "" || strings.HasPrefix(trimmed, commentPrefix)
+		}
+		return strings.HasPrefix(line[i:], commentPrefix)
+	}
+	return true
 }
@@ -7,11 +7,12 @@ import (
 	"io/fs"
 	"os"
 	"path/filepath"
-	"regexp"
 	"runtime"
+	"sort"
 	"strconv"
 	"strings"
 	"sync"
+	"time"
 )
 
 // Job represents a file to be processed
@@ -19,6 +20,7 @@ type Job struct {
 	Path      string
 	Extension string
 	LangKey   string
+	Size      int64 // file size in bytes, used for largest-first scheduling
 }
 
 // DirResult represents the outcome of processing a single file
@@ -36,6 +38,9 @@ type DirProcessor struct {
 	recursive    bool
 	useGitignore bool
 	workMode     string // "functions", "structs", or "all"
+	cache        *ResultCache
+	profile      *ScanProfile
+	shardSlice   ShardSlice // zero value: process every shard
 }
 
 // TreeNode represents a node in the directory tree for tree output
@@ -60,6 +65,27 @@ func NewDirProcessor(config Config, workers int, recursive, useGitignore bool, w
 	}
 }
 
+// SetResultCache attaches a persistent per-file result cache. Unchanged files
+// (same checksum) are then answered from the cache instead of being re-parsed.
+func (dp *DirProcessor) SetResultCache(cache *ResultCache) {
+	dp.cache = cache
+}
+
+// SetProfile attaches a ScanProfile (see scanprofile.go); the walk and worker
+// paths then record per-stage counters. A nil profile costs nothing.
+func (dp *DirProcessor) SetProfile(profile *ScanProfile) {
+	dp.profile = profile
+}
+
+// Workers reports the pool size, for sizing a ScanProfile.
+func (dp *DirProcessor) Workers() int { return dp.workers }
+
+// SetShardSlice restricts the walk to the directories owned by the given
+// slice (see ShardSlice), for fanning one scan out across processes.
+func (dp *DirProcessor) SetShardSlice(s ShardSlice) {
+	dp.shardSlice = s
+}
+
 // ProcessDirectory processes all supported files in a directory
 func (dp *DirProcessor) ProcessDirectory(rootPath string) ([]DirResult, error) {
 	// Collect all files first
@@ -76,83 +102,114 @@ func (dp *DirProcessor) ProcessDirectory(rootPath string) ([]DirResult, error) {
 	return dp.processFilesParallel(files)
 }
 
-// collectFiles walks the directory and collects all supported files
-func (dp *DirProcessor) collectFiles(rootPath string) ([]Job, error) {
-	var jobs []Job
-	var mu sync.Mutex
+// ProcessDirectoryStream is the streaming counterpart of ProcessDirectory:
+// instead of materializing every DirResult, it hands each result to emit as
+// soon as its worker finishes, so memory stays O(largest file) rather than
+// O(repo). The walk runs concurrently with the worker pool: jobs enter the
+// pool as directories are discovered, so parsing starts before the traversal
+// finishes. emit is called from a single goroutine, never concurrently.
+func (dp *DirProcessor) ProcessDirectoryStream(rootPath string, emit func(DirResult)) error {
+	jobsChan := make(chan Job, dp.workers*4)
 
-	// Load gitignore patterns if enabled
-	var ignoreMatcher *IgnoreMatcher
-	if dp.useGitignore {
-		ignoreMatcher = NewIgnoreMatcher(rootPath)
-	}
-
-	err := filepath.Walk(rootPath, func(path string, info fs.FileInfo, err error) error {
-		if err != nil {
-			// Skip files/directories that can't be accessed
-			return nil
-		}
+	walkErr := make(chan error, 1)
+	go func() {
+		walkErr <- dp.walkFiles(rootPath, func(job Job) {
+			jobsChan <- job
+		})
+		close(jobsChan)
+	}()
 
-		relPath, err := filepath.Rel(rootPath, path)
-		if err != nil {
-			return nil
-		}
+	if err := dp.runWorkerPool(jobsChan, emit); err != nil {
+		return err
+	}
+	return <-walkErr
+}
 
-		// Check if path matches gitignore patterns
-		if ignoreMatcher != nil && ignoreMatcher.Matches(relPath, info.IsDir()) {
-			// If it's a directory and we should skip it entirely
-			if info.IsDir() {
-				return filepath.SkipDir
-			}
-			// Skip the file
-			return nil
-		}
+// ProcessDirectoryStreamUntil is ProcessDirectoryStream with cooperative
+// cancellation: when emit returns false, job dispatch stops — the walker
+// drops all further files and only the handful of already-queued jobs still
+// finish (their results are discarded). Used by targeted search to stop the
+// scan once every requested name has been resolved.
+func (dp *DirProcessor) ProcessDirectoryStreamUntil(rootPath string, emit func(DirResult) bool) error {
+	jobsChan := make(chan Job, dp.workers*4)
+	done := make(chan struct{})
 
-		// Skip hidden files and directories (starting with .)
-		// except for .gitignore itself and the root path itself
-		base := filepath.Base(path)
-		if len(base) > 0 && base[0] == '.' && base != ".gitignore" && path != rootPath {
-			if info.IsDir() {
-				return filepath.SkipDir
+	walkErr := make(chan error, 1)
+	go func() {
+		walkErr <- dp.walkFiles(rootPath, func(job Job) {
+			select {
+			case jobsChan <- job:
+			case <-done:
+				// Cancelled: swallow the job so the walk drains quickly
 			}
-			return nil
-		}
+		})
+		close(jobsChan)
+	}()
 
-		// Skip directories if not recursive
-		if info.IsDir() {
-			if !dp.recursive && path != rootPath {
-				return filepath.SkipDir
-			}
-			return nil
+	stopped := false
+	if err := dp.runWorkerPool(jobsChan, func(r DirResult) {
+		if stopped {
+			return
 		}
-
-		// Check if file extension is supported
-		langConfig := dp.config.GetLanguageByExtension(path)
-		if langConfig == nil {
-			return nil
+		if !emit(r) {
+			stopped = true
+			close(done)
 		}
+	}); err != nil {
+		return err
+	}
+	return <-walkErr
+}
 
-		mu.Lock()
-		jobs = append(jobs, Job{
-			Path:      path,
-			Extension: filepath.Ext(path),
-			LangKey:   langConfig.LangKey,
-		})
-		mu.Unlock()
-
-		return nil
+// collectFiles walks the directory and collects all supported files.
+// The traversal itself is parallel (see walkFiles); results are sorted by
+// path so callers see the same deterministic order the serial walk produced.
+func (dp *DirProcessor) collectFiles(rootPath string) ([]Job, error) {
+	var jobs []Job
+	err := dp.walkFiles(rootPath, func(job Job) {
+		jobs = append(jobs, job)
 	})
-
 	if err != nil {
 		return nil, err
 	}
-
+	sort.Slice(jobs, func(i, j int) bool { return jobs[i].Path < jobs[j].Path })
 	return jobs, nil
 }
 
-// processFilesParallel processes files using a worker pool
+// processFilesParallel processes files using a worker pool.
+//
+// Jobs are dispatched largest-first (classic LPT scheduling): idle workers
+// pull the next job from the shared channel, so a handful of huge generated
+// files start immediately and run concurrently with the long tail of small
+// files, instead of stalling the scan when they happen to be queued last.
 func (dp *DirProcessor) processFilesParallel(jobs []Job) ([]DirResult, error) {
+	var results []DirResult
+	err := dp.processFilesStream(jobs, func(r DirResult) {
+		results = append(results, r)
+	})
+	return results, err
+}
+
+// processFilesStream runs the worker pool over a known job list and forwards
+// each result to emit from the collecting goroutine (one at a time, in
+// completion order). Because the full list is in hand, jobs are dispatched
+// largest-first; the walk-streaming path (ProcessDirectoryStream) cannot sort
+// and instead relies on overlapping traversal with parsing.
+func (dp *DirProcessor) processFilesStream(jobs []Job, emit func(DirResult)) error {
+	sortJobsLargestFirst(jobs)
+
 	jobsChan := make(chan Job, len(jobs))
+	for _, job := range jobs {
+		jobsChan <- job
+	}
+	close(jobsChan)
+
+	return dp.runWorkerPool(jobsChan, emit)
+}
+
+// runWorkerPool drains jobsChan with dp.workers goroutines and forwards each
+// DirResult to emit from a single collecting goroutine.
+func (dp *DirProcessor) runWorkerPool(jobsChan <-chan Job, emit func(DirResult)) error {
 	resultsChan := make(chan DirResult, dp.workers*2)
 
 	var wg sync.WaitGroup
@@ -162,41 +219,79 @@ func (dp *DirProcessor) processFilesParallel(jobs []Job) ([]DirResult, error) {
 		wg.Add(1)
 		go func(workerID int) {
 			defer wg.Done()
-			dp.worker(jobsChan, resultsChan)
+			dp.worker(workerID, jobsChan, resultsChan)
 		}(i)
 	}
 
-	// Send all jobs
-	for _, job := range jobs {
-		jobsChan <- job
-	}
-	close(jobsChan)
-
 	// Close results channel when all workers are done
 	go func() {
 		wg.Wait()
 		close(resultsChan)
 	}()
 
-	// Collect results
-	var results []DirResult
+	// Forward results as they arrive
 	for result := range resultsChan {
-		results = append(results, result)
+		emit(result)
 	}
 
-	return results, nil
+	// Persist cache updates once per run, not per file
+	if dp.cache != nil {
+		if err := dp.cache.Save(); err != nil {
+			WarnError("saving result cache: %v", err)
+		}
+	}
+
+	return nil
+}
+
+// sortJobsLargestFirst orders jobs by descending file size, ties broken by
+// path so the dispatch order is deterministic.
+func sortJobsLargestFirst(jobs []Job) {
+	sort.Slice(jobs, func(i, j int) bool {
+		if jobs[i].Size != jobs[j].Size {
+			return jobs[i].Size > jobs[j].Size
+		}
+		return jobs[i].Path < jobs[j].Path
+	})
 }
 
-// worker processes jobs from the channel
-func (dp *DirProcessor) worker(jobsChan <-chan Job, resultsChan chan<- DirResult) {
+// worker processes jobs from the channel. Each worker owns one fileScanner,
+// so finder and sanitizer allocations are reused across its whole job stream.
+func (dp *DirProcessor) worker(workerID int, jobsChan <-chan Job, resultsChan chan<- DirResult) {
+	scanner := newFileScanner()
 	for job := range jobsChan {
-		result := dp.processFile(job)
+		jobStart := time.Now()
+		result := dp.processFileCached(job, scanner)
+		dp.profile.noteProcessed(workerID, job, result, time.Since(jobStart))
 		resultsChan <- result
 	}
 }
 
+// processFileCached wraps processFile with the optional result cache: a file
+// whose checksum matches the cached entry is not re-parsed at all.
+func (dp *DirProcessor) processFileCached(job Job, scanner *fileScanner) DirResult {
+	if dp.cache == nil {
+		return dp.processFile(job, scanner)
+	}
+
+	checksum, err := computeFileChecksum(job.Path)
+	if err != nil {
+		// Unreadable file: fall through and let processFile report the error
+		return dp.processFile(job, scanner)
+	}
+
+	if cached, ok := dp.cache.Lookup(job.Path, checksum, dp.workMode); ok {
+		dp.profile.noteCacheHit()
+		return cached
+	}
+
+	result := dp.processFile(job, scanner)
+	dp.cache.Store(job.Path, checksum, dp.workMode, result)
+	return result
+}
+
 // processFile processes a single file
-func (dp *DirProcessor) processFile(job Job) DirResult {
+func (dp *DirProcessor) processFile(job Job, scanner *fileScanner) DirResult {
 	result := DirResult{
 		Path: job.Path,
 	}
@@ -210,8 +305,7 @@ func (dp *DirProcessor) processFile(job Job) DirResult {
 	switch dp.workMode {
 	case "functions":
 		// Find only functions
-		finder := CreateFinder(langConfig, "", "map", false, false)
-		findResult, err := finder.FindFunctions(job.Path)
+		findResult, err := scanner.findFunctions(langConfig, job.Path)
 		if err != nil {
 			result.Error = err
 			return result
@@ -225,9 +319,7 @@ func (dp *DirProcessor) processFile(job Job) DirResult {
 			// Skip languages without struct support
 			return result
 		}
-		factory := NewStructFinderFactory()
-		structFinder := factory.CreateStructFinder(langConfig, "", true, false)
-		structResult, err := structFinder.FindStructures(job.Path)
+		structResult, err := scanner.findStructures(langConfig, job.Path)
 		if err != nil {
 			result.Error = err
 			return result
@@ -242,9 +334,8 @@ func (dp *DirProcessor) processFile(job Job) DirResult {
 		}
 
 	case "all":
-		// Find both functions and structs
-		finder := CreateFinder(langConfig, "", "map", false, false)
-		findResult, err := finder.FindFunctions(job.Path)
+		// Find both functions and structs over one shared read+sanitize pass
+		findResult, structResult, err := scanner.findAll(langConfig, job.Path)
 		if err != nil {
 			result.Error = err
 			return result
@@ -252,26 +343,20 @@ func (dp *DirProcessor) processFile(job Job) DirResult {
 		result.Functions = findResult.Functions
 		result.Classes = findResult.Classes
 
-		// Also find structs if language supports it
-		if langConfig.HasStructSupport() {
-			factory := NewStructFinderFactory()
-			structFinder := factory.CreateStructFinder(langConfig, "", true, false)
-			structResult, err := structFinder.FindStructures(job.Path)
-			if err == nil {
-				// Dedup: only add types not already in Classes (from class_pattern)
-				seen := make(map[string]bool, len(result.Classes))
-				for _, c := range result.Classes {
-					seen[c.Name+":"+strconv.Itoa(c.Start)] = true
-				}
-				for _, typ := range structResult.Types {
-					key := typ.Name + ":" + strconv.Itoa(typ.Start)
-					if !seen[key] {
-						result.Classes = append(result.Classes, ClassBounds{
-							Name:  typ.Name,
-							Start: typ.Start,
-							End:   typ.End,
-						})
-					}
+		if structResult != nil {
+			// Dedup: only add types not already in Classes (from class_pattern)
+			seen := make(map[string]bool, len(result.Classes))
+			for _, c := range result.Classes {
+				seen[c.Name+":"+strconv.Itoa(c.Start)] = true
+			}
+			for _, typ := range structResult.Types {
+				key := typ.Name + ":" + strconv.Itoa(typ.Start)
+				if !seen[key] {
+					result.Classes = append(result.Classes, ClassBounds{
+						Name:  typ.Name,
+						Start: typ.Start,
+						End:   typ.End,
+					})
 				}
 			}
 		}
@@ -451,112 +536,6 @@ func formatDirResultsGrep(results []DirResult) string {
 	return output
 }
 
-// IgnoreMatcher handles .gitignore pattern matching
-type IgnoreMatcher struct {
-	patterns []ignorePattern
-	root     string
-}
-
-type ignorePattern struct {
-	regex     *regexp.Regexp
-	directory bool // pattern ends with /
-}
-
-func NewIgnoreMatcher(root string) *IgnoreMatcher {
-	m := &IgnoreMatcher{
-		root:     root,
-		patterns: make([]ignorePattern, 0),
-	}
-
-	// Load .gitignore from root
-	gitignorePath := filepath.Join(root, ".gitignore")
-	data, err := os.ReadFile(gitignorePath)
-	if err != nil {
-		return m
-	}
-
-	// Parse patterns
-	m.parsePatterns(string(data))
-	return m
-}
-
-func (m *IgnoreMatcher) parsePatterns(content string) {
-	lines := regexp.MustCompile(`\r?\n`).Split(content, -1)
-	for _, line := range lines {
-		line = regexp.MustCompile(`#.*`).ReplaceAllString(line, "")
-		line = strings.TrimSpace(line)
-		if line == "" {
-			continue
-		}
-
-		// Handle negation
-		negate := false
-		if strings.HasPrefix(line, "!") {
-			negate = true
-			line = strings.TrimSpace(line[1:])
-		}
-
-		if line == "" {
-			continue
-		}
-
-		// Handle directory patterns
-		isDir := strings.HasSuffix(line, "/")
-		if isDir {
-			line = strings.TrimSuffix(line, "/")
-		}
-
-		// Convert gitignore pattern to regex
-		regexStr := m.patternToRegex(line)
-		re, err := regexp.Compile(regexStr)
-		if err != nil {
-			continue
-		}
-
-		if !negate {
-			m.patterns = append(m.patterns, ignorePattern{
-				regex:     re,
-				directory: isDir,
-			})
-		}
-	}
-}
-
-func (m *IgnoreMatcher) patternToRegex(pattern string) string {
-	// Escape regex special characters except * and ?
-	regex := regexp.MustCompile(`([.+?^${}()|[\]\\])`).ReplaceAllStringFunc(pattern, func(match string) string {
-		return "\\" + match
-	})
-
-	// Handle ** glob pattern
-	regex = strings.ReplaceAll(regex, `\*\*`, ".*")
-
-	// Handle single * glob pattern
-	regex = strings.ReplaceAll(regex, `\*`, "[^/]*")
-
-	// Handle ? glob pattern
-	regex = strings.ReplaceAll(regex, `\?`, ".")
-
-	// Match full path or as subdirectory
-	if strings.HasPrefix(pattern, "/") {
-		return "^" + strings.TrimPrefix(regex, "/") + "$"
-	}
-
-	return "(^|/)" + regex + "($|/)"
-}
-
-func (m *IgnoreMatcher) Matches(path string, isDir bool) bool {
-	for _, p := range m.patterns {
-		if p.directory && !isDir {
-			continue
-		}
-		if p.regex.MatchString(path) {
-			return true
-		}
-	}
-	return false
-}
-
 // CollectSourceFiles finds all source files matching langConfig in rootPath.
 // It optionally respects .gitignore, skips hidden files/dirs, and honours recursive.
 // If langConfig is nil every supported extension is accepted.
@@ -643,8 +622,11 @@ type Manifest struct {
 // pathToShardName is an alias for the exported PathToShardName in shardutil.go.
 func pathToShardName(path string) string { return PathToShardName(path) }
 
-// WriteSplitOutput writes results to split shard files with a manifest
-func WriteSplitOutput(results []DirResult, outDir, rootDir, splitBy string) (string, error) {
+// WriteSplitOutput writes results to split shard files with a manifest.
+// The optional trailing flag enables gzip compression of the shard files
+// (see shardcompress.go); the manifest then records the ".gz" filenames.
+func WriteSplitOutput(results []DirResult, outDir, rootDir, splitBy string, compressOpt ...bool) (string, error) {
+	compress := len(compressOpt) > 0 && compressOpt[0]
 	// Create output directory
 	if err := os.MkdirAll(outDir, 0755); err != nil {
 		return "", fmt.Errorf("creating output directory: %w", err)
@@ -688,14 +670,18 @@ func WriteSplitOutput(results []DirResult, outDir, rootDir, splitBy string) (str
 	manifest.SplitBy = splitBy
 
 	for shardKey, shardResults := range shards {
-		shardName := pathToShardName(shardKey)
+		baseName := pathToShardName(shardKey)
+		shardName := baseName
+		if compress {
+			shardName += CompressedShardExt
+		}
 		shardPath := filepath.Join(outDir, shardName)
 
 		// Generate JSON content for this shard
 		content := formatDirResultsJSON(shardResults)
 
-		// Write shard file
-		if err := os.WriteFile(shardPath, []byte(content), 0644); err != nil {
+		// Write shard file (streamed through gzip when compression is on)
+		if err := writeShardContent(shardPath, content, compress); err != nil {
 			return "", fmt.Errorf("writing shard %s: %w", shardName, err)
 		}
 
@@ -706,7 +692,7 @@ func WriteSplitOutput(results []DirResult, outDir, rootDir, splitBy string) (str
 			totalFuncs += len(r.Functions)
 			totalClasses += len(r.Classes)
 		}
-		checksum := computeShardChecksum(allShardPaths[shardName])
+		checksum := computeShardChecksum(allShardPaths[baseName])
 
 		manifest.Shards = append(manifest.Shards, ShardInfo{
 			Path:           shardName,
@@ -728,9 +714,14 @@ func WriteSplitOutput(results []DirResult, outDir, rootDir, splitBy string) (str
 		return "", fmt.Errorf("writing manifest: %w", err)
 	}
 
+	// Binary symbol index alongside the JSON (see symbolindex.go)
+	if err := WriteSymbolIndex(symbolLocationsFromResults(results), outDir); err != nil {
+		return "", err
+	}
+
 	// Return summary for display
-	return fmt.Sprintf("Split output written to %s/\n  Manifest: manifest.json\n  Shards: %d files\n  Total: %d files, %d functions, %d classes",
-		outDir, len(manifest.Shards), manifest.TotalFiles, manifest.TotalFunctions, manifest.TotalClasses), nil
+	return fmt.Sprintf("Split output written to %s/\n  Manifest: manifest.json\n  Index: %s\n  Shards: %d files\n  Total: %d files, %d functions, %d classes",
+		outDir, SymbolIndexName, len(manifest.Shards), manifest.TotalFiles, manifest.TotalFunctions, manifest.TotalClasses), nil
 }
 
 // formatManifestJSON serialises the manifest with encoding/json. This matches
@@ -766,7 +757,9 @@ func (dp *DirProcessor) ProcessDirectoryIncremental(rootPath, outDir, splitBy st
 	oldChecksums := make(map[string]string)
 	if oldManifest != nil {
 		for _, s := range oldManifest.Shards {
-			oldChecksums[s.Path] = s.Checksum
+			// Keyed by base name so toggling --compress between runs
+			// still matches shards across manifests
+			oldChecksums[shardBaseName(s.Path)] = s.Checksum
 		}
 	}
 
@@ -836,8 +829,11 @@ func (dp *DirProcessor) ProcessDirectoryIncremental(rootPath, outDir, splitBy st
 	return dp.processFilesParallel(changedJobs)
 }
 
-// WriteSplitOutputIncremental writes results merging with unchanged shards from old manifest
-func WriteSplitOutputIncremental(results []DirResult, outDir, rootDir, splitBy string) (string, error) {
+// WriteSplitOutputIncremental writes results merging with unchanged shards
+// from the old manifest. The optional trailing flag gzip-compresses the
+// rewritten shard files, mirroring WriteSplitOutput.
+func WriteSplitOutputIncremental(results []DirResult, outDir, rootDir, splitBy string, compressOpt ...bool) (string, error) {
+	compress := len(compressOpt) > 0 && compressOpt[0]
 	// Load old manifest
 	oldManifest, _ := loadManifest(outDir)
 
@@ -882,12 +878,16 @@ func WriteSplitOutputIncremental(results []DirResult, outDir, rootDir, splitBy s
 
 	// Write updated shards
 	for shardKey, shardResults := range newShards {
-		shardName := pathToShardName(shardKey)
+		baseName := pathToShardName(shardKey)
+		shardName := baseName
+		if compress {
+			shardName += CompressedShardExt
+		}
 		shardPath := filepath.Join(outDir, shardName)
-		updatedShardNames[shardName] = true
+		updatedShardNames[baseName] = true
 
 		content := formatDirResultsJSON(shardResults)
-		if err := os.WriteFile(shardPath, []byte(content), 0644); err != nil {
+		if err := writeShardContent(shardPath, content, compress); err != nil {
 			return "", fmt.Errorf("writing shard %s: %w", shardName, err)
 		}
 
@@ -897,7 +897,7 @@ func WriteSplitOutputIncremental(results []DirResult, outDir, rootDir, splitBy s
 			totalFuncs += len(r.Functions)
 			totalClasses += len(r.Classes)
 		}
-		checksum := computeShardChecksum(allShardPaths[shardName])
+		checksum := computeShardChecksum(allShardPaths[baseName])
 
 		manifest.Shards = append(manifest.Shards, ShardInfo{
 			Path:           shardName,
@@ -912,10 +912,11 @@ func WriteSplitOutputIncremental(results []DirResult, outDir, rootDir, splitBy s
 		manifest.TotalClasses += totalClasses
 	}
 
-	// Copy unchanged shards from old manifest
+	// Copy unchanged shards from old manifest (matched by base name, so a
+	// compression toggle between runs cannot duplicate a shard)
 	if oldManifest != nil {
 		for _, oldShard := range oldManifest.Shards {
-			if !updatedShardNames[oldShard.Path] {
+			if !updatedShardNames[shardBaseName(oldShard.Path)] {
 				manifest.Shards = append(manifest.Shards, oldShard)
 				manifest.TotalFiles += oldShard.Files
 				manifest.TotalFunctions += oldShard.TotalFunctions
@@ -931,6 +932,23 @@ func WriteSplitOutputIncremental(results []DirResult, outDir, rootDir, splitBy s
 		return "", fmt.Errorf("writing manifest: %w", err)
 	}
 
+	// Merge the symbol index: keep old records from untouched shards, replace
+	// everything belonging to the shards rewritten above
+	locs := symbolLocationsFromResults(results)
+	if oldIdx, err := OpenSymbolIndex(filepath.Join(outDir, SymbolIndexName)); err == nil {
+		for i := 0; i < oldIdx.Len(); i++ {
+			loc := oldIdx.Record(i)
+			shardName := pathToShardName(ShardKeyForPath(loc.Path, rootDir, splitBy))
+			if !updatedShardNames[shardName] {
+				locs = append(locs, loc)
+			}
+		}
+		oldIdx.Close()
+	}
+	if err := WriteSymbolIndex(locs, outDir); err != nil {
+		return "", err
+	}
+
 	updatedCount := len(newShards)
 	unchangedCount := len(manifest.Shards) - updatedCount
 
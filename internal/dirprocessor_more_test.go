@@ -436,6 +436,23 @@ func TestProcessDirectoryIncremental_DetectsChangedFile(t *testing.T) {
 	}
 }
 
+func TestSortJobsLargestFirst(t *testing.T) {
+	jobs := []Job{
+		{Path: "small.go", Size: 10},
+		{Path: "huge.go", Size: 30_000_000},
+		{Path: "b.go", Size: 100},
+		{Path: "a.go", Size: 100},
+	}
+	sortJobsLargestFirst(jobs)
+
+	wantOrder := []string{"huge.go", "a.go", "b.go", "small.go"}
+	for i, want := range wantOrder {
+		if jobs[i].Path != want {
+			t.Errorf("jobs[%d].Path = %s, want %s", i, jobs[i].Path, want)
+		}
+	}
+}
+
 // --- test helpers ---
 
 func mustWrite(t *testing.T, path, content string) {
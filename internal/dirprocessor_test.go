@@ -41,7 +41,7 @@ public enum LogLevel {
 		LangKey:   "swift",
 	}
 
-	result := dp.processFile(job)
+	result := dp.processFile(job, newFileScanner())
 	if result.Error != nil {
 		t.Fatalf("processFile() error = %v", result.Error)
 	}
@@ -109,7 +109,7 @@ impl Handler for Config {
 		LangKey:   "rust",
 	}
 
-	result := dp.processFile(job)
+	result := dp.processFile(job, newFileScanner())
 	if result.Error != nil {
 		t.Fatalf("processFile() error = %v", result.Error)
 	}
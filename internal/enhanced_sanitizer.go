@@ -18,40 +18,31 @@ const (
 
 type State = ParserState
 
-// State classification maps for O(1) lookups
-var (
-	stringStates = map[ParserState]bool{
-		StateString:          true,
-		StateRawString:       true,
-		StateMultiLineString: true,
-		StateCharLiteral:     true,
-	}
-
-	commentStates = map[ParserState]bool{
-		StateLineComment:  true,
-		StateBlockComment: true,
-	}
-
-	literalStates = map[ParserState]bool{
-		StateString:          true,
-		StateRawString:       true,
-		StateMultiLineString: true,
-		StateCharLiteral:     true,
-		StateLineComment:     true,
-		StateBlockComment:    true,
-	}
-
-	validStates = map[ParserState]bool{
-		StateNormal:          true,
-		StateLineComment:     true,
-		StateBlockComment:    true,
-		StateString:          true,
-		StateRawString:       true,
-		StateCharLiteral:     true,
-		StateMultiLineString: true,
-	}
+// State classification via a flat table instead of map lookups: indexing an
+// array by state is a single bounds-checked load, where the former
+// map[ParserState]bool lookups hashed on every IsInString/IsInLiteral call.
+const (
+	classString uint8 = 1 << iota
+	classComment
+	classValid
 )
 
+var stateClass = [StateMultiLineString + 1]uint8{
+	StateNormal:          classValid,
+	StateLineComment:     classValid | classComment,
+	StateBlockComment:    classValid | classComment,
+	StateString:          classValid | classString,
+	StateRawString:       classValid | classString,
+	StateCharLiteral:     classValid | classString,
+	StateMultiLineString: classValid | classString,
+}
+
+// hasClass reports whether the state carries any of the given class bits.
+// Out-of-range states (corrupted values) classify as nothing.
+func (s ParserState) hasClass(mask uint8) bool {
+	return s >= 0 && int(s) < len(stateClass) && stateClass[s]&mask != 0
+}
+
 func (s ParserState) String() string {
 	switch s {
 	case StateNormal:
@@ -73,17 +64,99 @@ func (s ParserState) String() string {
 	}
 }
 
-// Sanitizer provides code sanitization by removing comments and string literals
+// Sanitizer provides code sanitization by removing comments and string literals.
+// A Sanitizer is not safe for concurrent use: CleanLine reuses per-instance
+// scratch buffers so that sanitizing a stream of files allocates nothing per
+// line.
 type Sanitizer struct {
 	config *LanguageConfig
 	useRaw bool
+
+	// Scratch buffers reused across CleanLine calls (the returned string is
+	// always a fresh copy, so reuse is invisible to callers).
+	lineBuf   []rune
+	resultBuf []rune
+
+	// Bulk-skip byte tables, built once per sanitizer from the language
+	// config. In each state the scanner can jump over every ASCII byte whose
+	// table entry is false without consulting the pattern handlers, which
+	// lets plain code and long literal runs stream through the hot loop.
+	// fastPath is false when any delimiter starts with a non-ASCII byte
+	// (never the case for languages.json, but stay correct for custom
+	// configs) — then every byte goes through the handlers as before.
+	fastPath       int // 0 = unknown, 1 = enabled, -1 = disabled
+	normalBoundary [128]bool
+	stringBoundary [128]bool
+	rawBoundary    [128]bool
+	charBoundary   [128]bool
 }
 
 func NewSanitizer(config *LanguageConfig, useRaw bool) *Sanitizer {
-	return &Sanitizer{
+	s := &Sanitizer{
 		config: config,
 		useRaw: useRaw,
 	}
+	s.buildBoundaryTables()
+	return s
+}
+
+// markBoundary records the first byte of each pattern in table; a pattern
+// whose first byte is non-ASCII disables the fast path entirely.
+func (s *Sanitizer) markBoundary(table *[128]bool, patterns ...string) {
+	for _, p := range patterns {
+		if p == "" {
+			continue
+		}
+		if p[0] >= 0x80 {
+			s.fastPath = -1
+			continue
+		}
+		table[p[0]] = true
+	}
+}
+
+func (s *Sanitizer) buildBoundaryTables() {
+	s.fastPath = 1
+	c := s.config
+
+	// StateNormal: anything that can open a comment, string, char literal
+	// or docstring.
+	s.markBoundary(&s.normalBoundary, c.LineComment, c.BlockCommentStart)
+	s.markBoundary(&s.normalBoundary, c.StringChars...)
+	s.markBoundary(&s.normalBoundary, c.RawStringChars...)
+	s.markBoundary(&s.normalBoundary, c.CharDelimiters...)
+	s.markBoundary(&s.normalBoundary, c.DocStringMarkers...)
+
+	// StateString / StateCharLiteral: only the escape char and the closing
+	// delimiter are interesting; everything else is blanked wholesale.
+	s.markBoundary(&s.stringBoundary, c.EscapeChar)
+	s.markBoundary(&s.stringBoundary, c.StringChars...)
+	s.markBoundary(&s.charBoundary, c.EscapeChar)
+	s.markBoundary(&s.charBoundary, c.CharDelimiters...)
+
+	// StateRawString: no escapes, only the closing delimiter.
+	s.markBoundary(&s.rawBoundary, c.RawStringChars...)
+}
+
+// skipPlain advances idx over ASCII runes whose table entry is false. When
+// copy is true the skipped runes are copied into result (plain code);
+// otherwise they are left as the spaces result is prefilled with (literal
+// and comment interiors).
+func (s *Sanitizer) skipPlain(table *[128]bool, runes []rune, result []rune, idx int, copyRunes bool) int {
+	if s.fastPath != 1 {
+		return idx
+	}
+	for idx < len(runes) {
+		r := runes[idx]
+		if r >= 0x80 || table[r] {
+			break
+		}
+		if copyRunes {
+			result[idx] = r
+		}
+		idx++
+	}
+	return idx
 }
 
 // Helper functions for filling result buffer with spaces
@@ -260,7 +333,7 @@ func (s *Sanitizer) handleCharLiteral(runes []rune, result []rune, idx int) (int
 }
 
 func (s *Sanitizer) handleMultiLineString(line string, runes []rune, result []rune, idx int) (int, ParserState) {
-	_ = line // retained for signature symmetry; scanning is rune-based
+	_ = line       // retained for signature symmetry; scanning is rune-based
 	foundEnd := -1 // absolute rune index of the closing delimiter
 	foundDelim := ""
 	newState := StateMultiLineString
@@ -442,8 +515,18 @@ func (s *Sanitizer) CleanLine(line string, state ParserState) (string, ParserSta
 
 	// Size the buffer by rune count, not byte count: a byte-sized buffer would
 	// leave (bytes-runes) trailing spaces on lines containing multibyte runes.
-	runes := []rune(line)
-	result := make([]rune, len(runes))
+	// Both buffers are per-sanitizer scratch space, grown once and reused for
+	// every subsequent line.
+	runes := s.lineBuf[:0]
+	for _, r := range line {
+		runes = append(runes, r)
+	}
+	s.lineBuf = runes
+
+	if cap(s.resultBuf) < len(runes) {
+		s.resultBuf = make([]rune, len(runes))
+	}
+	result := s.resultBuf[:len(runes)]
 	for i := range result {
 		result[i] = ' '
 	}
@@ -457,14 +540,28 @@ func (s *Sanitizer) CleanLine(line string, state ParserState) (string, ParserSta
 			continue
 
 		case StateString:
+			// Bulk-skip: interior bytes stay as prefilled spaces
+			if idx = s.skipPlain(&s.stringBoundary, runes, result, idx, false); idx >= len(runes) {
+				continue
+			}
 			idx, state = s.handleString(runes, result, idx)
 			continue
 
 		case StateRawString:
+			// With useRaw the interior is copied, so only the blanking path
+			// may bulk-skip
+			if !s.useRaw {
+				if idx = s.skipPlain(&s.rawBoundary, runes, result, idx, false); idx >= len(runes) {
+					continue
+				}
+			}
 			idx, state = s.handleRawString(runes, result, idx)
 			continue
 
 		case StateCharLiteral:
+			if idx = s.skipPlain(&s.charBoundary, runes, result, idx, false); idx >= len(runes) {
+				continue
+			}
 			idx, state = s.handleCharLiteral(runes, result, idx)
 			continue
 
@@ -473,6 +570,13 @@ func (s *Sanitizer) CleanLine(line string, state ParserState) (string, ParserSta
 			continue
 
 		case StateNormal:
+			// Bulk-skip: copy plain code until the next byte that can open
+			// a comment, string or char literal — the common case is an
+			// entire line of code with no literals at all
+			if idx = s.skipPlain(&s.normalBoundary, runes, result, idx, true); idx >= len(runes) {
+				continue
+			}
+
 			// Try handlers in priority order
 			var handled bool
 
@@ -530,22 +634,36 @@ func (s *Sanitizer) CleanCode(code string) string {
 }
 
 func (s *Sanitizer) IsInString(state State) bool {
-	return stringStates[state]
+	return state.hasClass(classString)
 }
 
 func (s *Sanitizer) IsInComment(state State) bool {
-	return commentStates[state]
+	return state.hasClass(classComment)
 }
 
 func (s *Sanitizer) IsInLiteral(state State) bool {
-	return literalStates[state]
+	return state.hasClass(classString | classComment)
 }
 
 func (s *Sanitizer) GetConfig() *LanguageConfig {
 	return s.config
 }
 
-func (s *Sanitizer) Reset() {}
+// Reset retargets the sanitizer to another language config, rebuilding the
+// boundary tables but keeping the scratch buffers, so one sanitizer can serve
+// a whole stream of files across languages without reallocating.
+func (s *Sanitizer) Reset(config *LanguageConfig, useRaw bool) {
+	if s.config == config && s.useRaw == useRaw {
+		return
+	}
+	s.config = config
+	s.useRaw = useRaw
+	s.normalBoundary = [128]bool{}
+	s.stringBoundary = [128]bool{}
+	s.rawBoundary = [128]bool{}
+	s.charBoundary = [128]bool{}
+	s.buildBoundaryTables()
+}
 
 // Backward compatibility aliases for tests
 type EnhancedSanitizer = Sanitizer
@@ -556,7 +674,7 @@ func NewEnhancedSanitizer(config *LanguageConfig) *EnhancedSanitizer {
 
 // Utility functions
 func ValidState(state ParserState) bool {
-	return validStates[state]
+	return state.hasClass(classValid)
 }
 
 func CountBraces(line string) int {
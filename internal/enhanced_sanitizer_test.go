@@ -521,8 +521,20 @@ func TestEnhancedSanitizer_Reset(t *testing.T) {
 		t.Skip("Test requires string state")
 	}
 
-	// Сбрасываем состояние
-	s.Reset()
+	// Перенацеливаем на другой язык и проверяем, что таблицы перестроились
+	cppConfig := newCppConfig()
+	s.Reset(cppConfig, false)
+
+	cleaned, state := s.CleanLine(`int x = 1; // comment`, StateNormal)
+	if state != StateNormal {
+		t.Errorf("CleanLine() state = %v, want StateNormal", state)
+	}
+	if strings.Contains(cleaned, "comment") {
+		t.Errorf("Comment should be removed after Reset(), got %q", cleaned)
+	}
+	if !strings.Contains(cleaned, "int x = 1;") {
+		t.Errorf("Code should survive Reset(), got %q", cleaned)
+	}
 }
 
 // Дополнительный тест для реального сценария с шаблонами C++
@@ -0,0 +1,111 @@
+package internal
+
+import (
+	"strings"
+	"testing"
+)
+
+// TestFieldScanner_LineMayBeField: байтовый гейт обязан отбрасывать строки,
+// которые заведомо не дадут поля, и пропускать все настоящие объявления.
+func TestFieldScanner_LineMayBeField(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	tests := []struct {
+		lang string
+		line string
+		want bool
+	}{
+		// Скобки — метод, регулярка не нужна
+		{"cs", "    public string GetName() { return name; }", false},
+		{"cs", "    public User(string name) { }", false},
+		// Пунктуационные строки без идентификаторов
+		{"cs", "    {", false},
+		{"cs", "    }", false},
+		{"cs", "", false},
+		// Настоящие поля проходят гейт
+		{"cs", "    public string Name;", true},
+		{"cs", "    private int age = 42;", true},
+		{"go", "\tID   int", true},
+		// Python/Rust: обязательный литерал ':' из field_pattern
+		{"py", "    name: str", true},
+		{"py", "    just_a_statement", false},
+		{"rust", "    pub id: u64,", true},
+		{"rust", "    unsafe_block", false},
+	}
+
+	for _, tt := range tests {
+		langConfig, err := config.GetLanguageConfig(tt.lang)
+		if err != nil {
+			t.Fatalf("GetLanguageConfig(%s) error = %v", tt.lang, err)
+		}
+		fs := newFieldScanner(langConfig)
+		if fs == nil {
+			t.Fatalf("newFieldScanner(%s) = nil, language has a field pattern", tt.lang)
+		}
+		if got := fs.lineMayBeField(tt.line); got != tt.want {
+			t.Errorf("%s: lineMayBeField(%q) = %v, want %v", tt.lang, tt.line, got, tt.want)
+		}
+	}
+}
+
+// TestFieldScanner_GateMatchesRegex: на DTO-подобном C# исходнике гейт не
+// должен терять ни одного поля относительно прямого прогона регулярки.
+func TestFieldScanner_GateMatchesRegex(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	csConfig, err := config.GetLanguageConfig("cs")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig(cs) error = %v", err)
+	}
+
+	code := `public class UserDto
+{
+    public int Id;
+    public string Name { get; set; }
+    private readonly DateTime createdAt;
+    protected List<string> tags = new List<string>();
+    public string FullName() { return Name; }
+}
+`
+	lines := strings.Split(code, "\n")
+	cleaned := NewSanitizer(csConfig, false).CleanLines(lines)
+
+	fs := newFieldScanner(csConfig)
+	regex := csConfig.GetFieldPattern()
+	for i, line := range cleaned {
+		matches := regex.FindStringSubmatch(line)
+		// Совпадение регулярки, которое не отбрасывается как метод, обязано
+		// пройти и гейт
+		if matches != nil && len(matches) >= 2 && !strings.ContainsAny(line, "()") {
+			if !fs.lineMayBeField(line) {
+				t.Errorf("line %d: gate rejected a real field: %q", i+1, lines[i])
+			}
+		}
+	}
+
+	finder := NewStructFinderFactory().CreateStructFinder(csConfig, "", true, false)
+	result, err := finder.FindStructuresInLines(lines, 1, "user_dto.cs")
+	if err != nil {
+		t.Fatalf("FindStructuresInLines() error = %v", err)
+	}
+	if len(result.Types) != 1 {
+		t.Fatalf("found %d types, want 1", len(result.Types))
+	}
+	fieldNames := make(map[string]bool)
+	for _, f := range result.Types[0].Fields {
+		fieldNames[f.Name] = true
+	}
+	for _, want := range []string{"Id", "createdAt"} {
+		if !fieldNames[want] {
+			t.Errorf("field %s not found; got %v", want, result.Types[0].Fields)
+		}
+	}
+	if fieldNames["FullName"] {
+		t.Errorf("method FullName reported as a field")
+	}
+}
@@ -0,0 +1,89 @@
+// fileread.go - Zero-copy whole-file reading for the scanners.
+//
+// bufio.Scanner materializes every line as a fresh string, which on large
+// generated sources (multi-megabyte C++ translation units) makes allocation
+// and copying dominate the profile. readFileLinesZeroCopy maps the file once
+// and returns lines as substrings of a single backing string, discovered by a
+// plain IndexByte sweep — no per-line allocation, no second copy.
+package internal
+
+import (
+	"strings"
+	"sync"
+	"unsafe"
+)
+
+// linesPool recycles the per-file line slice between reads. After release the
+// pooled strings dangle into an unmapped file, but every reuse starts from a
+// truncated slice and overwrites the stale headers before anything reads them.
+var linesPool = sync.Pool{New: func() any { return new([]string) }}
+
+// readFileLinesZeroCopy returns the lines of path as slices into one shared
+// backing string (the memory-mapped file on unix). Line semantics match
+// bufio.Scanner with ScanLines: the trailing newline is not included, a
+// final line without a newline is returned, and a trailing "\r" is stripped.
+//
+// The release function must be called once the lines — and any substrings of
+// them — are no longer referenced; until then the mapping stays valid.
+func readFileLinesZeroCopy(path string) ([]string, func(), error) {
+	data, release, err := mmapFile(path)
+	if err != nil {
+		return nil, nil, err
+	}
+	if len(data) == 0 {
+		return nil, release, nil
+	}
+
+	// View the mapped bytes as a string without copying. The release closure
+	// keeps the mapping alive for as long as the caller holds the lines.
+	content := unsafe.String(unsafe.SliceData(data), len(data))
+
+	bufp := linesPool.Get().(*[]string)
+	lines := splitLinesNoCopy(content, (*bufp)[:0])
+	*bufp = lines
+
+	return lines, func() {
+		*bufp = (*bufp)[:0]
+		linesPool.Put(bufp)
+		release()
+	}, nil
+}
+
+// splitLinesNoCopy splits content into lines as substrings of content itself,
+// appending into buf (which may carry capacity from a previous file).
+func splitLinesNoCopy(content string, buf []string) []string {
+	// Pre-size: count newlines in one sweep so append never reallocates.
+	lines := buf
+	if n := strings.Count(content, "\n") + 1; cap(lines) < n {
+		lines = make([]string, 0, n)
+	}
+
+	for pos := 0; pos < len(content); {
+		i := strings.IndexByte(content[pos:], '\n')
+		if i < 0 {
+			lines = append(lines, dropCR(content[pos:]))
+			break
+		}
+		lines = append(lines, dropCR(content[pos:pos+i]))
+		pos += i + 1
+	}
+	return lines
+}
+
+// dropCR removes a trailing \r (CRLF line endings), like bufio.ScanLines.
+func dropCR(line string) string {
+	if len(line) > 0 && line[len(line)-1] == '\r' {
+		return line[:len(line)-1]
+	}
+	return line
+}
+
+// detachFunctionLines copies extracted body lines out of the shared backing
+// string so results stay valid after the file mapping is released.
+func detachFunctionLines(result *FindResult) {
+	for i := range result.Functions {
+		for j, line := range result.Functions[i].Lines {
+			result.Functions[i].Lines[j] = strings.Clone(line)
+		}
+	}
+}
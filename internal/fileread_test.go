@@ -0,0 +1,92 @@
+package internal
+
+import (
+	"bufio"
+	"os"
+	"path/filepath"
+	"reflect"
+	"strings"
+	"testing"
+)
+
+// TestReadFileLinesZeroCopy_MatchesScanner pins the line semantics to
+// bufio.Scanner with ScanLines, which the old reading path used.
+func TestReadFileLinesZeroCopy_MatchesScanner(t *testing.T) {
+	cases := []struct {
+		name    string
+		content string
+	}{
+		{"empty", ""},
+		{"single line no newline", "hello"},
+		{"single line with newline", "hello\n"},
+		{"trailing blank line", "a\n\n"},
+		{"blank line in middle", "a\n\nb"},
+		{"crlf endings", "a\r\nb\r\n"},
+		{"mixed endings", "a\r\nb\nc"},
+		{"only newlines", "\n\n\n"},
+		{"unicode", "привет\nмир\n"},
+	}
+
+	for _, tc := range cases {
+		t.Run(tc.name, func(t *testing.T) {
+			path := filepath.Join(t.TempDir(), "f.txt")
+			if err := os.WriteFile(path, []byte(tc.content), 0644); err != nil {
+				t.Fatalf("write: %v", err)
+			}
+
+			var want []string
+			sc := bufio.NewScanner(strings.NewReader(tc.content))
+			for sc.Scan() {
+				want = append(want, sc.Text())
+			}
+
+			got, release, err := readFileLinesZeroCopy(path)
+			if err != nil {
+				t.Fatalf("readFileLinesZeroCopy() error = %v", err)
+			}
+			defer release()
+
+			if len(got) == 0 && len(want) == 0 {
+				return
+			}
+			if !reflect.DeepEqual(got, want) {
+				t.Errorf("lines = %q, want %q (scanner semantics)", got, want)
+			}
+		})
+	}
+}
+
+// TestFindFunctions_ExtractDetachesFromMapping verifies that extracted bodies
+// remain valid after FindFunctions returns and the file mapping is released.
+func TestFindFunctions_ExtractDetachesFromMapping(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "f.go")
+	code := "package main\n\nfunc Hello() {\n\tprintln(\"hi\")\n}\n"
+	if err := os.WriteFile(path, []byte(code), 0644); err != nil {
+		t.Fatalf("write: %v", err)
+	}
+
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig() error = %v", err)
+	}
+
+	finder := NewFinder(langConfig, []string{"Hello"}, false, true, false)
+	result, err := finder.FindFunctions(path)
+	if err != nil {
+		t.Fatalf("FindFunctions() error = %v", err)
+	}
+	if len(result.Functions) != 1 {
+		t.Fatalf("expected 1 function, got %d", len(result.Functions))
+	}
+
+	// The mapping was released inside FindFunctions; the body lines must
+	// still be readable and correct.
+	lines := result.Functions[0].Lines
+	if len(lines) != 3 || lines[0] != "func Hello() {" || lines[2] != "}" {
+		t.Errorf("extracted lines = %q", lines)
+	}
+}
@@ -0,0 +1,133 @@
+// filescanner.go - Per-worker reuse of finder allocations in directory mode.
+//
+// Every job used to construct a fresh Finder (sanitizer, boundary tables,
+// name map) and StructFinder per file; on large scans those throwaway objects
+// are almost pure GC load. A fileScanner belongs to one worker goroutine and
+// keeps a single brace-based finder that is Reset() between languages, plus
+// per-language instances for the finder kinds that copy their config or
+// differ in type (indent-based, hybrid).
+package internal
+
+// fileScanner caches finder instances for one worker's job stream.
+// It is not safe for concurrent use; each worker goroutine owns one.
+type fileScanner struct {
+	braceFinder       *Finder
+	braceStructFinder *StructFinder
+	factory           *StructFinderFactory
+
+	// Finders that cannot be retargeted in place, keyed by language.
+	otherFinders       map[string]LanguageFinder
+	otherStructFinders map[string]StructFinderInterface
+}
+
+func newFileScanner() *fileScanner {
+	return &fileScanner{
+		factory:            NewStructFinderFactory(),
+		otherFinders:       make(map[string]LanguageFinder),
+		otherStructFinders: make(map[string]StructFinderInterface),
+	}
+}
+
+// findFunctions runs the function finder for langConfig over path, reusing
+// this worker's finder allocations. Settings match directory mode: map mode,
+// no name filter, no body extraction.
+func (sc *fileScanner) findFunctions(langConfig *LanguageConfig, path string) (*FindResult, error) {
+	if langConfig.IndentBased {
+		f, ok := sc.otherFinders[langConfig.LangKey]
+		if !ok {
+			f = CreateFinder(langConfig, "", "map", false, false)
+			sc.otherFinders[langConfig.LangKey] = f
+		}
+		return f.FindFunctions(path)
+	}
+
+	if sc.braceFinder == nil {
+		sc.braceFinder = NewFinder(langConfig, nil, true, false, false)
+	} else {
+		sc.braceFinder.Reset(langConfig)
+	}
+	return sc.braceFinder.FindFunctions(path)
+}
+
+// findAll runs the function and struct finders over one shared read+sanitize
+// pass (see scanpipeline.go). Indent-based languages fall back to the
+// separate passes since their finders do their own line processing.
+// structResult is nil when the language has no struct support or the struct
+// pass failed — matching "all" mode's long-standing behavior of keeping the
+// function results in that case.
+func (sc *fileScanner) findAll(langConfig *LanguageConfig, path string) (*FindResult, *StructFindResult, error) {
+	if langConfig.IndentBased {
+		fr, err := sc.findFunctions(langConfig, path)
+		if err != nil {
+			return nil, nil, err
+		}
+		if !langConfig.HasStructSupport() {
+			return fr, nil, nil
+		}
+		sr, err := sc.findStructures(langConfig, path)
+		if err != nil {
+			return fr, nil, nil
+		}
+		return fr, sr, nil
+	}
+
+	if sc.braceFinder == nil {
+		sc.braceFinder = NewFinder(langConfig, nil, true, false, false)
+	} else {
+		sc.braceFinder.Reset(langConfig)
+	}
+
+	scan, err := ScanFile(path, sc.braceFinder.sanitizer)
+	if err != nil {
+		return nil, nil, err
+	}
+	defer scan.Release()
+
+	fr, err := sc.braceFinder.FindFunctionsScanned(scan)
+	if err != nil {
+		return nil, nil, err
+	}
+	if !langConfig.HasStructSupport() {
+		return fr, nil, nil
+	}
+
+	var sr *StructFindResult
+	if sc.factory.determineFinderType(langConfig) == FinderTypeBrace {
+		if sc.braceStructFinder == nil {
+			sc.braceStructFinder = NewStructFinder(langConfig, "", true)
+		} else {
+			sc.braceStructFinder.Reset(langConfig)
+		}
+		sr, err = sc.braceStructFinder.FindStructuresScanned(scan)
+	} else {
+		f, ok := sc.otherStructFinders[langConfig.LangKey]
+		if !ok {
+			f = sc.factory.CreateStructFinder(langConfig, "", true, false)
+			sc.otherStructFinders[langConfig.LangKey] = f
+		}
+		sr, err = f.FindStructuresScanned(scan)
+	}
+	if err != nil {
+		return fr, nil, nil
+	}
+	return fr, sr, nil
+}
+
+// findStructures is the struct-mode counterpart of findFunctions.
+func (sc *fileScanner) findStructures(langConfig *LanguageConfig, path string) (*StructFindResult, error) {
+	if sc.factory.determineFinderType(langConfig) == FinderTypeBrace {
+		if sc.braceStructFinder == nil {
+			sc.braceStructFinder = NewStructFinder(langConfig, "", true)
+		} else {
+			sc.braceStructFinder.Reset(langConfig)
+		}
+		return sc.braceStructFinder.FindStructures(path)
+	}
+
+	f, ok := sc.otherStructFinders[langConfig.LangKey]
+	if !ok {
+		f = sc.factory.CreateStructFinder(langConfig, "", true, false)
+		sc.otherStructFinders[langConfig.LangKey] = f
+	}
+	return f.FindStructures(path)
+}
@@ -0,0 +1,88 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+// TestFileScanner_ReuseAcrossLanguages checks that one worker's fileScanner,
+// retargeted between languages via Reset(), finds exactly what fresh
+// throwaway finders find.
+func TestFileScanner_ReuseAcrossLanguages(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	dir := t.TempDir()
+	files := map[string]string{
+		"a.go": "package a\n\nfunc Alpha() {\n\treturn\n}\n\ntype Box struct {\n\tX int\n}\n",
+		"b.c":  "int beta(int x) {\n\treturn x;\n}\n",
+		"c.py": "def gamma():\n    pass\n",
+		// Back to Go: the brace finder must have been retargeted twice by now
+		"d.go": "package d\n\nfunc Delta() {}\n",
+	}
+	var paths []string
+	for name, content := range files {
+		p := filepath.Join(dir, name)
+		if err := os.WriteFile(p, []byte(content), 0644); err != nil {
+			t.Fatalf("WriteFile(%s) error = %v", name, err)
+		}
+		paths = append(paths, p)
+	}
+
+	scanner := newFileScanner()
+	for _, p := range paths {
+		langConfig := config.GetLanguageByExtension(p)
+		if langConfig == nil {
+			t.Fatalf("no language for %s", p)
+		}
+
+		got, err := scanner.findFunctions(langConfig, p)
+		if err != nil {
+			t.Fatalf("scanner.findFunctions(%s) error = %v", p, err)
+		}
+
+		fresh := CreateFinder(langConfig, "", "map", false, false)
+		want, err := fresh.FindFunctions(p)
+		if err != nil {
+			t.Fatalf("FindFunctions(%s) error = %v", p, err)
+		}
+
+		if len(got.Functions) != len(want.Functions) {
+			t.Fatalf("%s: reused scanner found %d functions, fresh finder %d",
+				p, len(got.Functions), len(want.Functions))
+		}
+		for i := range got.Functions {
+			if got.Functions[i].Name != want.Functions[i].Name ||
+				got.Functions[i].Start != want.Functions[i].Start ||
+				got.Functions[i].End != want.Functions[i].End {
+				t.Errorf("%s: function %d = %+v, want %+v",
+					p, i, got.Functions[i], want.Functions[i])
+			}
+		}
+
+		if !langConfig.HasStructSupport() {
+			continue
+		}
+		gotS, err := scanner.findStructures(langConfig, p)
+		if err != nil {
+			t.Fatalf("scanner.findStructures(%s) error = %v", p, err)
+		}
+		freshS := NewStructFinderFactory().CreateStructFinder(langConfig, "", true, false)
+		wantS, err := freshS.FindStructures(p)
+		if err != nil {
+			t.Fatalf("FindStructures(%s) error = %v", p, err)
+		}
+		if len(gotS.Types) != len(wantS.Types) {
+			t.Fatalf("%s: reused scanner found %d types, fresh finder %d",
+				p, len(gotS.Types), len(wantS.Types))
+		}
+		for i := range gotS.Types {
+			if gotS.Types[i].Name != wantS.Types[i].Name || gotS.Types[i].Start != wantS.Types[i].Start {
+				t.Errorf("%s: type %d = %+v, want %+v", p, i, gotS.Types[i], wantS.Types[i])
+			}
+		}
+	}
+}
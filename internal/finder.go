@@ -1,9 +1,7 @@
 package internal
 
 import (
-	"bufio"
 	"fmt"
-	"os"
 	"strings"
 )
 
@@ -45,6 +43,7 @@ type Finder struct {
 	funcNames   map[string]bool
 	mapMode     bool
 	extractMode bool
+	firstMatch  bool // ранний выход: хватит первого вхождения каждого имени
 }
 
 // NewFinder создает новый искатель функций
@@ -63,30 +62,86 @@ func NewFinder(config *LanguageConfig, funcNames []string, mapMode, extractMode,
 	}
 }
 
+// SetFirstMatch включает ранний выход при целевом поиске: сканирование файла
+// останавливается, как только каждое из запрошенных имён найдено и закрыто.
+// В map-режиме не действует.
+func (f *Finder) SetFirstMatch(v bool) {
+	f.firstMatch = v
+}
+
+// pendingNames возвращает копию funcNames для отслеживания ещё не найденных
+// имён, либо nil, если ранний выход не применим.
+func (f *Finder) pendingNames() map[string]bool {
+	if !f.firstMatch || f.mapMode || len(f.funcNames) == 0 {
+		return nil
+	}
+	pending := make(map[string]bool, len(f.funcNames))
+	for name := range f.funcNames {
+		pending[name] = true
+	}
+	return pending
+}
+
+// Reset перенацеливает искатель на другой язык, сохраняя накопленные
+// буферы санитайзера — воркеры в directory-режиме переиспользуют один
+// Finder на весь поток файлов вместо создания нового на каждый файл.
+// Настройки поиска (имена, mapMode, extractMode) не меняются.
+func (f *Finder) Reset(config *LanguageConfig) {
+	if f.config == config {
+		return
+	}
+	f.config = config
+	f.sanitizer.Reset(config, f.sanitizer.useRaw)
+}
+
 // FindFunctions ищет функции в файле
 func (f *Finder) FindFunctions(filename string) (*FindResult, error) {
-	file, err := os.Open(filename)
+	// Zero-copy read: lines are slices into the mapped file, released below.
+	lines, release, err := readFileLinesZeroCopy(filename)
 	if err != nil {
 		return nil, fmt.Errorf("failed to open file: %w", err)
 	}
-	defer file.Close()
-	
-	// Читаем файл построчно
-	var lines []string
-	scanner := bufio.NewScanner(file)
-	for scanner.Scan() {
-		lines = append(lines, scanner.Text())
+	defer release()
+
+	result, err := f.FindFunctionsInLines(lines, 1, filename)
+	if err != nil {
+		return nil, err
 	}
-	if err := scanner.Err(); err != nil {
-		return nil, fmt.Errorf("failed to read file: %w", err)
+	if f.extractMode {
+		// Extracted bodies must outlive the mapping
+		detachFunctionLines(result)
 	}
-	
-	return f.FindFunctionsInLines(lines, 1, filename)
+	return result, nil
 }
 
 // FindFunctionsInLines ищет функции в предварительно прочитанных строках
 // startLine - номер первой строки в lines (1-based) относительно оригинального файла
 func (f *Finder) FindFunctionsInLines(lines []string, startLine int, filename string) (*FindResult, error) {
+	// Санитизация выполняется один раз на все проходы (классы + функции);
+	// для очень больших файлов — чанк-параллельно (parallel_sanitizer.go)
+	cleaned := f.sanitizer.CleanLinesParallel(lines, 0)
+	return f.findFunctionsInCleaned(lines, cleaned, startLine, filename)
+}
+
+// FindFunctionsScanned ищет функции по уже прочитанному и санитизированному
+// скану — общий конвейер (FileScan) читает и чистит файл один раз для всех
+// анализаторов.
+func (f *Finder) FindFunctionsScanned(scan *FileScan) (*FindResult, error) {
+	result, err := f.findFunctionsInCleaned(scan.Lines, scan.Cleaned, 1, scan.Path)
+	if err != nil {
+		return nil, err
+	}
+	if f.extractMode {
+		// Тела функций ссылаются на raw-строки скана — копируем, чтобы
+		// результат пережил scan.Release()
+		detachFunctionLines(result)
+	}
+	return result, nil
+}
+
+// findFunctionsInCleaned — общая реализация: cleaned[i] — санитизированная
+// форма lines[i].
+func (f *Finder) findFunctionsInCleaned(lines, cleaned []string, startLine int, filename string) (*FindResult, error) {
 	lineOffset := startLine - 1 // Offset для корректировки номеров строк
 
 	result := &FindResult{
@@ -98,30 +153,29 @@ func (f *Finder) FindFunctionsInLines(lines []string, startLine int, filename st
 	// Если язык поддерживает классы, сначала находим все классы
 	var classes []ClassBounds
 	if f.config.HasClasses() {
-		classes = f.findClassesWithOffset(lines, lineOffset)
+		classes = f.findClassesWithOffset(lines, cleaned, lineOffset)
 		result.Classes = classes
 	}
 
 	// Проверяем, поддерживает ли язык вложенные функции
 	if f.config.SupportsNested {
-		return f.findFunctionsWithNesting(lines, lineOffset, classes, result)
+		return f.findFunctionsWithNesting(lines, cleaned, lineOffset, classes, result)
 	}
 
 	// Старая логика для языков без вложенных функций
-	return f.findFunctionsSimple(lines, lineOffset, classes, result)
+	return f.findFunctionsSimple(lines, cleaned, lineOffset, classes, result)
 }
 
 // findFunctionsSimple - старая логика для языков без вложенных функций
-func (f *Finder) findFunctionsSimple(lines []string, lineOffset int, classes []ClassBounds, result *FindResult) (*FindResult, error) {
-	state := StateNormal
+func (f *Finder) findFunctionsSimple(lines, cleanedLines []string, lineOffset int, classes []ClassBounds, result *FindResult) (*FindResult, error) {
 	var currentFunc *FunctionBounds
 	depth := 0
 	funcRegex := f.config.FuncRegex()
+	funcLiteral := f.config.FuncLiteral()
+	pending := f.pendingNames()
 
 	for lineNum, line := range lines {
-		// Очищаем строку от комментариев и литералов
-		cleaned, newState := f.sanitizer.CleanLine(line, state)
-		state = newState
+		cleaned := cleanedLines[lineNum]
 
 		// Если мы внутри функции, отслеживаем баланс скобок
 		if currentFunc != nil {
@@ -156,9 +210,21 @@ func (f *Finder) findFunctionsSimple(lines []string, lineOffset int, classes []C
 				// Конец функции
 				currentFunc.End = lineNum + 1 + lineOffset // 1-based + offset
 				result.Functions = append(result.Functions, *currentFunc)
+				if pending != nil {
+					delete(pending, currentFunc.Name)
+					if len(pending) == 0 {
+						return result, nil
+					}
+				}
 				currentFunc = nil
 			}
 		} else {
+			// Prefilter: всякий матч обязан содержать литерал паттерна —
+			// дешёвый Contains отсекает строку до запуска RE2
+			if funcLiteral != "" && !strings.Contains(cleaned, funcLiteral) {
+				continue
+			}
+
 			// Ищем начало новой функции
 			matches := funcRegex.FindStringSubmatch(cleaned)
 			if matches != nil {
@@ -218,6 +284,12 @@ func (f *Finder) findFunctionsSimple(lines []string, lineOffset int, classes []C
 						// на этой же строке.
 						currentFunc.End = lineNum + 1 + lineOffset
 						result.Functions = append(result.Functions, *currentFunc)
+						if pending != nil {
+							delete(pending, currentFunc.Name)
+							if len(pending) == 0 {
+								return result, nil
+							}
+						}
 						currentFunc = nil
 					}
 					// Иначе: скобка открыта и ещё не закрыта (depth > 0), или
@@ -237,15 +309,14 @@ func (f *Finder) findFunctionsSimple(lines []string, lineOffset int, classes []C
 }
 
 // findFunctionsWithNesting - новая логика для языков с вложенными функциями
-func (f *Finder) findFunctionsWithNesting(lines []string, lineOffset int, classes []ClassBounds, result *FindResult) (*FindResult, error) {
-	state := StateNormal
+func (f *Finder) findFunctionsWithNesting(lines, cleanedLines []string, lineOffset int, classes []ClassBounds, result *FindResult) (*FindResult, error) {
 	funcStack := []*FunctionContext{} // Стек активных функций
 	funcRegex := f.config.FuncRegex()
+	funcLiteral := f.config.FuncLiteral()
+	pending := f.pendingNames()
 
 	for lineNum, line := range lines {
-		// Очищаем строку от комментариев и литералов
-		cleaned, newState := f.sanitizer.CleanLine(line, state)
-		state = newState
+		cleaned := cleanedLines[lineNum]
 
 		braceDelta := CountBraces(cleaned)
 
@@ -264,7 +335,11 @@ func (f *Finder) findFunctionsWithNesting(lines []string, lineOffset int, classe
 		}
 
 		// 3. Ищем новые функции на ЛЮБОМ уровне вложенности
-		matches := funcRegex.FindStringSubmatch(cleaned)
+		// (сначала дешёвый литеральный prefilter, затем RE2)
+		var matches []string
+		if funcLiteral == "" || strings.Contains(cleaned, funcLiteral) {
+			matches = funcRegex.FindStringSubmatch(cleaned)
+		}
 		if matches != nil {
 			// Извлекаем имя функции
 			funcName := ""
@@ -309,6 +384,9 @@ func (f *Finder) findFunctionsWithNesting(lines []string, lineOffset int, classe
 				if braceDelta == 0 && strings.Contains(cleaned, "{") {
 					newFunc.End = lineNum + 1 + lineOffset
 					result.Functions = append(result.Functions, *newFunc)
+					if pending != nil {
+						delete(pending, newFunc.Name)
+					}
 				} else {
 					// Добавляем новую функцию в стек
 					ctx := &FunctionContext{
@@ -329,6 +407,9 @@ func (f *Finder) findFunctionsWithNesting(lines []string, lineOffset int, classe
 				// Конец функции
 				ctx.Func.End = lineNum + 1 + lineOffset
 				result.Functions = append(result.Functions, *ctx.Func)
+				if pending != nil {
+					delete(pending, ctx.Func.Name)
+				}
 				// Не добавляем в новый стек (удаляем)
 			} else {
 				// Оставляем в стеке
@@ -336,6 +417,11 @@ func (f *Finder) findFunctionsWithNesting(lines []string, lineOffset int, classe
 			}
 		}
 		funcStack = newStack
+
+		// Ранний выход: все запрошенные имена найдены и закрыты
+		if pending != nil && len(pending) == 0 && len(funcStack) == 0 {
+			break
+		}
 	}
 
 	return result, nil
@@ -358,24 +444,23 @@ func ParseFuncNames(funcStr string) []string {
 }
 // findClasses находит все классы в файле
 func (f *Finder) findClasses(lines []string) []ClassBounds {
-	return f.findClassesWithOffset(lines, 0)
+	return f.findClassesWithOffset(lines, f.sanitizer.CleanLines(lines), 0)
 }
 
 // findClassesWithOffset находит все классы с учетом offset номеров строк
-func (f *Finder) findClassesWithOffset(lines []string, lineOffset int) []ClassBounds {
+func (f *Finder) findClassesWithOffset(lines, cleanedLines []string, lineOffset int) []ClassBounds {
 	var classes []ClassBounds
 	var currentClass *ClassBounds
 	classRegex := f.config.ClassRegex()
 	if classRegex == nil {
 		return classes
 	}
+	classLiteral := f.config.ClassLiteral()
 
-	state := StateNormal
 	classDepth := 0
 
-	for lineNum, line := range lines {
-		cleaned, newState := f.sanitizer.CleanLine(line, state)
-		state = newState
+	for lineNum := range lines {
+		cleaned := cleanedLines[lineNum]
 
 		if currentClass != nil {
 			// Отслеживаем баланс скобок
@@ -390,7 +475,10 @@ func (f *Finder) findClassesWithOffset(lines []string, lineOffset int) []ClassBo
 				classDepth = 0
 			}
 		} else {
-			// Ищем начало нового класса
+			// Ищем начало нового класса (с литеральным prefilter)
+			if classLiteral != "" && !strings.Contains(cleaned, classLiteral) {
+				continue
+			}
 			matches := classRegex.FindStringSubmatch(cleaned)
 			if matches != nil && len(matches) >= 2 {
 				className := matches[1]
@@ -5,6 +5,17 @@ type LanguageFinder interface {
 	FindFunctions(filename string) (*FindResult, error)
 }
 
+// SetFirstMatch включает ранний выход целевого поиска на искателях, которые
+// его поддерживают; остальные остаются без изменений.
+func SetFirstMatch(f LanguageFinder, v bool) {
+	switch finder := f.(type) {
+	case *Finder:
+		finder.SetFirstMatch(v)
+	case *PythonFinder:
+		finder.SetFirstMatch(v)
+	}
+}
+
 // CreateFinder создает подходящий парсер в зависимости от языка
 func CreateFinder(config *LanguageConfig, funcNamesStr string, mode string, extract bool, useRaw bool) LanguageFinder {
 	// Для языков на основе отступов (Python) используем специальный парсер
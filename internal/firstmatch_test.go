@@ -0,0 +1,179 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+// TestFinder_FirstMatch_Equivalence: с --first-match целевой поиск должен
+// давать тот же результат, что и полный проход, если каждое имя встречается
+// в файле один раз.
+func TestFinder_FirstMatch_Equivalence(t *testing.T) {
+	tmpDir := t.TempDir()
+	testFile := filepath.Join(tmpDir, "test.go")
+	code := `package main
+
+func Alpha() {
+	println("a")
+}
+
+func Beta() {
+	println("b")
+}
+
+func Gamma() {
+	println("c")
+}
+`
+	if err := os.WriteFile(testFile, []byte(code), 0644); err != nil {
+		t.Fatalf("Failed to create test file: %v", err)
+	}
+
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig(go) error = %v", err)
+	}
+
+	full := NewFinder(langConfig, []string{"Alpha", "Beta"}, false, false, false)
+	fullResult, err := full.FindFunctions(testFile)
+	if err != nil {
+		t.Fatalf("FindFunctions() error = %v", err)
+	}
+
+	early := NewFinder(langConfig, []string{"Alpha", "Beta"}, false, false, false)
+	early.SetFirstMatch(true)
+	earlyResult, err := early.FindFunctions(testFile)
+	if err != nil {
+		t.Fatalf("FindFunctions() with first-match error = %v", err)
+	}
+
+	if len(fullResult.Functions) != 2 || len(earlyResult.Functions) != 2 {
+		t.Fatalf("Found %d/%d functions, want 2/2", len(fullResult.Functions), len(earlyResult.Functions))
+	}
+	for i := range fullResult.Functions {
+		want, got := fullResult.Functions[i], earlyResult.Functions[i]
+		if want.Name != got.Name || want.Start != got.Start || want.End != got.End {
+			t.Errorf("function %d: first-match %s %d-%d, full %s %d-%d", i, got.Name, got.Start, got.End, want.Name, want.Start, want.End)
+		}
+	}
+}
+
+// TestFinder_FirstMatch_StopsAtFirstOccurrence: при повторяющихся именах
+// (методы с одним именем у разных receiver'ов) ранний выход оставляет
+// только первое вхождение каждого имени.
+func TestFinder_FirstMatch_StopsAtFirstOccurrence(t *testing.T) {
+	tmpDir := t.TempDir()
+	testFile := filepath.Join(tmpDir, "test.go")
+	code := `package main
+
+func (a *A) Close() {
+	a.done = true
+}
+
+func (b *B) Close() {
+	b.done = true
+}
+`
+	if err := os.WriteFile(testFile, []byte(code), 0644); err != nil {
+		t.Fatalf("Failed to create test file: %v", err)
+	}
+
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig(go) error = %v", err)
+	}
+
+	finder := NewFinder(langConfig, []string{"Close"}, false, false, false)
+	finder.SetFirstMatch(true)
+	result, err := finder.FindFunctions(testFile)
+	if err != nil {
+		t.Fatalf("FindFunctions() error = %v", err)
+	}
+
+	if len(result.Functions) != 1 {
+		t.Fatalf("Found %d functions, want 1 (early exit after first Close)", len(result.Functions))
+	}
+	if result.Functions[0].Start != 3 {
+		t.Errorf("Close() starts at line %d, want 3 (first occurrence)", result.Functions[0].Start)
+	}
+}
+
+// TestPythonFinder_FirstMatch: ранний выход работает и для indent-based
+// парсера — второе вхождение имени не попадает в результат.
+func TestPythonFinder_FirstMatch(t *testing.T) {
+	tmpDir := t.TempDir()
+	testFile := filepath.Join(tmpDir, "test.py")
+	code := `def setup():
+    pass
+
+def setup():
+    pass
+`
+	if err := os.WriteFile(testFile, []byte(code), 0644); err != nil {
+		t.Fatalf("Failed to create test file: %v", err)
+	}
+
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("py")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig(py) error = %v", err)
+	}
+
+	finder := NewPythonFinder(*langConfig, "setup", "func", false)
+	finder.SetFirstMatch(true)
+	result, err := finder.FindFunctions(testFile)
+	if err != nil {
+		t.Fatalf("FindFunctions() error = %v", err)
+	}
+
+	if len(result.Functions) != 1 {
+		t.Fatalf("Found %d functions, want 1 (early exit after first setup)", len(result.Functions))
+	}
+	if result.Functions[0].Start != 1 {
+		t.Errorf("setup() starts at line %d, want 1", result.Functions[0].Start)
+	}
+}
+
+// TestProcessDirectoryStreamUntil_Stops: после первого emit == false обход
+// прекращается без ошибки и новые результаты не доставляются.
+func TestProcessDirectoryStreamUntil_Stops(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	root := t.TempDir()
+	for i := 0; i < 20; i++ {
+		name := filepath.Join(root, "f"+string(rune('a'+i))+".go")
+		code := "package p\n\nfunc Fn() {\n}\n"
+		if err := os.WriteFile(name, []byte(code), 0644); err != nil {
+			t.Fatalf("WriteFile() error = %v", err)
+		}
+	}
+
+	dp := NewDirProcessor(config, 2, true, false, "functions")
+	emitted := 0
+	err = dp.ProcessDirectoryStreamUntil(root, func(r DirResult) bool {
+		emitted++
+		return false
+	})
+	if err != nil {
+		t.Fatalf("ProcessDirectoryStreamUntil() error = %v", err)
+	}
+
+	if emitted != 1 {
+		t.Errorf("emit called %d times after cancellation, want 1", emitted)
+	}
+}
@@ -1,8 +1,10 @@
 package internal
 
 import (
+	"bufio"
 	"encoding/json"
 	"fmt"
+	"io"
 	"strings"
 )
 
@@ -60,3 +62,59 @@ func FormatExtract(result *FindResult) string {
 	}
 	return strings.Join(parts, "\n\n")
 }
+
+// FormatExtractTo — ленивый потоковый вариант FormatExtract: тела функций не
+// обязаны лежать в FunctionBounds.Lines. Для функций с пустым Lines тело
+// читается напрямую из файла по диапазону Start..End (один zero-copy маппинг
+// на весь вывод) и пишется в w построчно. Память остаётся плоской независимо
+// от числа и размера функций; вывод побайтово совпадает с
+// fmt.Println(FormatExtract(result)) для тех же результатов.
+func FormatExtractTo(w io.Writer, result *FindResult, filename string) error {
+	bw := bufio.NewWriter(w)
+
+	// Файл открывается лениво — только если хоть одной функции нужно тело
+	var fileLines []string
+	var release func()
+	defer func() {
+		if release != nil {
+			release()
+		}
+	}()
+
+	for i, fn := range result.Functions {
+		if i > 0 {
+			bw.WriteString("\n\n") //nolint:errcheck
+		}
+		fmt.Fprintf(bw, "// %s: %d-%d\n", fn.Name, fn.Start, fn.End) //nolint:errcheck
+
+		body := fn.Lines
+		if len(body) == 0 {
+			if fileLines == nil {
+				var err error
+				fileLines, release, err = readFileLinesZeroCopy(filename)
+				if err != nil {
+					return fmt.Errorf("reading %s for extraction: %w", filename, err)
+				}
+			}
+			lo, hi := fn.Start-1, fn.End
+			if lo < 0 {
+				lo = 0
+			}
+			if hi > len(fileLines) {
+				hi = len(fileLines)
+			}
+			if lo > hi {
+				lo = hi
+			}
+			body = fileLines[lo:hi]
+		}
+		for j, line := range body {
+			if j > 0 {
+				bw.WriteByte('\n') //nolint:errcheck
+			}
+			bw.WriteString(line) //nolint:errcheck
+		}
+	}
+	bw.WriteByte('\n') //nolint:errcheck
+	return bw.Flush()
+}
@@ -1,7 +1,10 @@
 package internal
 
 import (
+	"bytes"
 	"encoding/json"
+	"os"
+	"path/filepath"
 	"testing"
 )
 
@@ -353,3 +356,50 @@ func TestFormatExtract_WithSpecialChars(t *testing.T) {
 		t.Errorf("FormatExtract() didn't handle special chars correctly:\ngot:  %q\nwant: %q", output, expected)
 	}
 }
+
+// TestFormatExtractTo_LazyMatchesEager: потоковый ленивый вывод (без
+// скопированных Lines) должен побайтово совпадать с FormatExtract по
+// результату eager-экстракции того же файла.
+func TestFormatExtractTo_LazyMatchesEager(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	goConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig() error = %v", err)
+	}
+
+	dir := t.TempDir()
+	path := filepath.Join(dir, "a.go")
+	src := "package p\n\nfunc One() {\n\tx := 1\n\t_ = x\n}\n\nfunc Two() {\n}\n"
+	if err := os.WriteFile(path, []byte(src), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+
+	eager := CreateFinder(goConfig, "", "map", true, false)
+	eagerResult, err := eager.FindFunctions(path)
+	if err != nil {
+		t.Fatalf("FindFunctions() error = %v", err)
+	}
+	want := FormatExtract(eagerResult) + "\n"
+
+	lazy := CreateFinder(goConfig, "", "map", false, false)
+	lazyResult, err := lazy.FindFunctions(path)
+	if err != nil {
+		t.Fatalf("FindFunctions() error = %v", err)
+	}
+	for _, fn := range lazyResult.Functions {
+		if len(fn.Lines) != 0 {
+			t.Fatalf("lazy result unexpectedly carries body lines for %s", fn.Name)
+		}
+	}
+
+	var buf bytes.Buffer
+	if err := FormatExtractTo(&buf, lazyResult, path); err != nil {
+		t.Fatalf("FormatExtractTo() error = %v", err)
+	}
+	if buf.String() != want {
+		t.Errorf("lazy output = %q\nwant %q", buf.String(), want)
+	}
+}
@@ -0,0 +1,183 @@
+//go:build ignore
+
+// gen_languages.go - go:generate program that compiles languages.json into
+// languages_gen.go, a set of package-level Go declarations. This removes JSON
+// parsing and compile-all-regexes from process startup: shell pipelines that
+// invoke the tools thousands of times no longer pay the config tax per call.
+//
+// Run via: go generate ./internal  (directive lives in config.go)
+//
+// languages.json stays the source of truth; edit it and regenerate. The
+// equivalence test in languages_gen_test.go pins the generated code to the
+// JSON so a stale generated file fails CI.
+package main
+
+import (
+	"bytes"
+	"encoding/json"
+	"fmt"
+	"go/format"
+	"log"
+	"os"
+	"regexp"
+	"sort"
+	"strings"
+
+	"github.com/ruslano69/funcfinder/internal"
+)
+
+// identClassForValidation mirrors identClass in identifiers.go; only used to
+// check that patterns with {IDENT} expanded actually compile.
+const identClassForValidation = `[\p{L}\p{Nd}_]`
+
+func validate(lang, what, pattern string) {
+	if pattern == "" {
+		return
+	}
+	expanded := strings.ReplaceAll(pattern, "{IDENT}", identClassForValidation)
+	if _, err := regexp.Compile(expanded); err != nil {
+		log.Fatalf("%s: invalid %s pattern: %v", lang, what, err)
+	}
+}
+
+func main() {
+	data, err := os.ReadFile("languages.json")
+	if err != nil {
+		log.Fatalf("reading languages.json: %v", err)
+	}
+
+	var raw map[string]*internal.LanguageConfigWithMap
+	if err := json.Unmarshal(data, &raw); err != nil {
+		log.Fatalf("parsing languages.json: %v", err)
+	}
+
+	langs := make([]string, 0, len(raw))
+	for lang := range raw {
+		langs = append(langs, lang)
+	}
+	sort.Strings(langs)
+
+	var buf bytes.Buffer
+	buf.WriteString("// Code generated by gen_languages.go from languages.json; DO NOT EDIT.\n\n")
+	buf.WriteString("package internal\n\n")
+	buf.WriteString("func init() {\n\tbuiltinConfig = Config{\n")
+
+	for _, lang := range langs {
+		c := raw[lang].LanguageConfig
+
+		validate(lang, "func", c.FuncPattern)
+		validate(lang, "class", c.ClassPattern)
+		validate(lang, "field", c.FieldPattern)
+		validate(lang, "call", c.CallPattern)
+		validate(lang, "import", c.ImportPattern)
+		validate(lang, "decorator", c.DecoratorPattern)
+		for kind, p := range raw[lang].StructTypePatternsMap {
+			validate(lang, "struct:"+kind, p)
+		}
+
+		fmt.Fprintf(&buf, "\t\t%q: {\n", lang)
+		emitString(&buf, "Name", c.Name)
+		emitStrings(&buf, "Extensions", c.Extensions)
+		emitString(&buf, "FuncPattern", c.FuncPattern)
+		emitString(&buf, "ClassPattern", c.ClassPattern)
+
+		// struct_type_patterns: JSON object → sorted slice, same order as
+		// loadConfigFromJSON produces
+		if len(raw[lang].StructTypePatternsMap) > 0 {
+			kinds := make([]string, 0, len(raw[lang].StructTypePatternsMap))
+			for kind := range raw[lang].StructTypePatternsMap {
+				kinds = append(kinds, kind)
+			}
+			sort.Strings(kinds)
+			buf.WriteString("\t\t\tStructTypePatterns: []StructTypePattern{\n")
+			for _, kind := range kinds {
+				fmt.Fprintf(&buf, "\t\t\t\t{Type: %q, Pattern: %q},\n", kind, raw[lang].StructTypePatternsMap[kind])
+			}
+			buf.WriteString("\t\t\t},\n")
+		}
+
+		emitString(&buf, "FieldPattern", c.FieldPattern)
+		emitString(&buf, "CallPattern", c.CallPattern)
+		emitStrings(&buf, "ExcludeWords", c.ExcludeWords)
+		emitString(&buf, "DecoratorPattern", c.DecoratorPattern)
+		emitString(&buf, "ImportPattern", c.ImportPattern)
+		emitString(&buf, "MultiLineBlock", c.MultiLineBlock)
+		emitStrings(&buf, "ExcludePatterns", c.ExcludePatterns)
+		emitString(&buf, "LineComment", c.LineComment)
+		emitString(&buf, "BlockCommentStart", c.BlockCommentStart)
+		emitString(&buf, "BlockCommentEnd", c.BlockCommentEnd)
+		emitStrings(&buf, "StringChars", c.StringChars)
+		emitStrings(&buf, "RawStringChars", c.RawStringChars)
+		emitString(&buf, "EscapeChar", c.EscapeChar)
+		emitStrings(&buf, "CharDelimiters", c.CharDelimiters)
+		emitStrings(&buf, "DocStringMarkers", c.DocStringMarkers)
+		emitBool(&buf, "IndentBased", c.IndentBased)
+		emitString(&buf, "BlockEndKeyword", c.BlockEndKeyword)
+		emitBool(&buf, "SupportsNested", c.SupportsNested)
+
+		// Bake in the "LangKey defaults to the map key" rule
+		langKey := c.LangKey
+		if langKey == "" {
+			langKey = lang
+		}
+		emitString(&buf, "LangKey", langKey)
+
+		if len(c.ExtraPatterns) > 0 {
+			keys := make([]string, 0, len(c.ExtraPatterns))
+			for k := range c.ExtraPatterns {
+				keys = append(keys, k)
+			}
+			sort.Strings(keys)
+			buf.WriteString("\t\t\tExtraPatterns: map[string]string{\n")
+			for _, k := range keys {
+				fmt.Fprintf(&buf, "\t\t\t\t%q: %q,\n", k, c.ExtraPatterns[k])
+			}
+			buf.WriteString("\t\t\t},\n")
+		}
+
+		buf.WriteString("\t\t},\n")
+	}
+
+	buf.WriteString("\t}\n}\n")
+
+	formatted, err := format.Source(buf.Bytes())
+	if err != nil {
+		log.Fatalf("formatting generated code: %v", err)
+	}
+	if err := os.WriteFile("languages_gen.go", formatted, 0644); err != nil {
+		log.Fatalf("writing languages_gen.go: %v", err)
+	}
+	fmt.Printf("languages_gen.go: %d languages\n", len(langs))
+}
+
+func emitString(buf *bytes.Buffer, field, value string) {
+	if value != "" {
+		fmt.Fprintf(buf, "\t\t\t%s: %q,\n", field, value)
+	}
+}
+
+// emitStrings keeps the nil/empty distinction from the JSON ("key": [] vs
+// absent key) so the equivalence test can compare serialised forms exactly.
+func emitStrings(buf *bytes.Buffer, field string, values []string) {
+	if values == nil {
+		return
+	}
+	if len(values) == 0 {
+		fmt.Fprintf(buf, "\t\t\t%s: []string{},\n", field)
+		return
+	}
+	fmt.Fprintf(buf, "\t\t\t%s: []string{", field)
+	for i, v := range values {
+		if i > 0 {
+			buf.WriteString(", ")
+		}
+		fmt.Fprintf(buf, "%q", v)
+	}
+	buf.WriteString("},\n")
+}
+
+func emitBool(buf *bytes.Buffer, field string, value bool) {
+	if value {
+		fmt.Fprintf(buf, "\t\t\t%s: true,\n", field)
+	}
+}
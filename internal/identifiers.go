@@ -1,6 +1,9 @@
 package internal
 
-import "strings"
+import (
+	"strings"
+	"unicode"
+)
 
 // identClass is the single source of truth for the character class that makes
 // up a source-code identifier across the whole toolkit.
@@ -27,6 +30,18 @@ const identClass = `[\p{L}\p{Nd}_]`
 // `{IDENT}+` directly, matching the old `\w+` behaviour.
 const identStart = `[\p{L}_]`
 
+// isIdentStartRune and isIdentRune are the rune-level equivalents of
+// identStart and identClass, for scanners that walk lines directly instead of
+// going through RE2. Keep all four in sync: `\p{L}` ↔ unicode.IsLetter,
+// `\p{Nd}` ↔ unicode.IsDigit.
+func isIdentStartRune(r rune) bool {
+	return r == '_' || unicode.IsLetter(r)
+}
+
+func isIdentRune(r rune) bool {
+	return r == '_' || unicode.IsLetter(r) || unicode.IsDigit(r)
+}
+
 // expandIdentPlaceholder substitutes the `{IDENT}` token in a raw pattern with
 // identClass. It is a no-op for patterns that don't use the token, so it is
 // safe to apply to every pattern before compilation.
@@ -0,0 +1,299 @@
+// ignore.go - Compiled .gitignore engine for the directory walk.
+//
+// The old matcher compiled every .gitignore line into a regex and ran the
+// whole list against every path, so on large trees ignore matching cost more
+// than parsing. Here each .gitignore is compiled once into buckets: plain
+// names go into a set matched per path segment, "*.ext"-style lines into a
+// suffix list, anchored literals into an exact-path set, and only true globs
+// keep a regex. Compiled files are cached by mtime/size so repeated walks
+// (watch polls, rescans) never re-parse, and directory verdicts are memoized
+// so a pruned directory is decided by one map lookup and never descended.
+//
+// Semantics match the old engine: negation ("!") lines are dropped, a
+// trailing "/" marks a directory-only pattern, and a leading "/" anchors the
+// pattern to the .gitignore's own directory.
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"regexp"
+	"strings"
+	"sync"
+)
+
+// ignorePattern is the regex fallback for patterns that are true globs.
+type ignorePattern struct {
+	regex     *regexp.Regexp
+	directory bool // pattern ends with /
+}
+
+type suffixRule struct {
+	suffix  string
+	dirOnly bool
+}
+
+// compiledIgnore holds one .gitignore compiled into match buckets. Map values
+// are true when the rule is directory-only; when the same name appears both
+// with and without a trailing slash the less restrictive form wins.
+type compiledIgnore struct {
+	names    map[string]bool // plain segment names: "vendor", "build/"
+	paths    map[string]bool // anchored literals: "/docs/generated"
+	suffixes []suffixRule    // "*.log", "*~"
+	globs    []ignorePattern // everything else
+}
+
+func (c *compiledIgnore) empty() bool {
+	return c == nil || (len(c.names) == 0 && len(c.paths) == 0 && len(c.suffixes) == 0 && len(c.globs) == 0)
+}
+
+// compileIgnore parses .gitignore content into a compiledIgnore.
+func compileIgnore(content string) *compiledIgnore {
+	c := &compiledIgnore{}
+	for _, line := range strings.Split(content, "\n") {
+		if idx := strings.IndexByte(line, '#'); idx >= 0 {
+			line = line[:idx]
+		}
+		line = strings.TrimSpace(line)
+		if line == "" {
+			continue
+		}
+
+		// Negation lines are dropped, same as the old parser: we only
+		// ever ignore more, never re-include.
+		if strings.HasPrefix(line, "!") {
+			continue
+		}
+
+		dirOnly := strings.HasSuffix(line, "/")
+		if dirOnly {
+			line = strings.TrimSuffix(line, "/")
+			if line == "" {
+				continue
+			}
+		}
+
+		// Only * and ? are glob metacharacters here — the old regex
+		// translation escaped [ and ] as literals.
+		hasGlob := strings.ContainsAny(line, "*?")
+
+		switch {
+		case !hasGlob && strings.HasPrefix(line, "/"):
+			addRule(&c.paths, strings.TrimPrefix(line, "/"), dirOnly)
+		case !hasGlob && !strings.Contains(line, "/"):
+			addRule(&c.names, line, dirOnly)
+		case strings.HasPrefix(line, "*") && len(line) > 1 &&
+			!strings.ContainsAny(line[1:], "*?") && !strings.Contains(line[1:], "/"):
+			c.suffixes = append(c.suffixes, suffixRule{suffix: line[1:], dirOnly: dirOnly})
+		default:
+			re, err := regexp.Compile(globToRegex(line))
+			if err != nil {
+				continue
+			}
+			c.globs = append(c.globs, ignorePattern{regex: re, directory: dirOnly})
+		}
+	}
+	return c
+}
+
+// addRule inserts a name/path rule; a pre-existing any-type rule beats a
+// directory-only one for the same key.
+func addRule(m *map[string]bool, key string, dirOnly bool) {
+	if *m == nil {
+		*m = make(map[string]bool)
+	}
+	if old, ok := (*m)[key]; ok {
+		(*m)[key] = old && dirOnly
+		return
+	}
+	(*m)[key] = dirOnly
+}
+
+// globToRegex converts a gitignore glob to a regex: ** crosses directories,
+// * stays within one segment, ? is any char. The old translation forgot to
+// escape * before substituting, so "**" patterns produced invalid regexes and
+// were silently dropped; QuoteMeta makes the substitutions reliable.
+func globToRegex(pattern string) string {
+	regex := regexp.QuoteMeta(pattern)
+
+	regex = strings.ReplaceAll(regex, `\*\*`, ".*")
+	regex = strings.ReplaceAll(regex, `\*`, "[^/]*")
+	regex = strings.ReplaceAll(regex, `\?`, ".")
+
+	if strings.HasPrefix(pattern, "/") {
+		return "^" + strings.TrimPrefix(regex, "/") + "$"
+	}
+	return "(^|/)" + regex + "($|/)"
+}
+
+// match reports whether rel (relative to this .gitignore's directory) is
+// covered by any rule. Segment buckets are checked first — they are the
+// common case and need no regex at all.
+func (c *compiledIgnore) match(rel string, isDir bool) bool {
+	if c.empty() {
+		return false
+	}
+
+	if dirOnly, ok := c.paths[rel]; ok && (!dirOnly || isDir) {
+		return true
+	}
+
+	if len(c.names) > 0 || len(c.suffixes) > 0 {
+		for start := 0; start <= len(rel); {
+			var seg string
+			if end := strings.IndexByte(rel[start:], '/'); end < 0 {
+				seg = rel[start:]
+				start = len(rel) + 1
+			} else {
+				seg = rel[start : start+end]
+				start += end + 1
+			}
+			if dirOnly, ok := c.names[seg]; ok && (!dirOnly || isDir) {
+				return true
+			}
+			for _, s := range c.suffixes {
+				if (!s.dirOnly || isDir) && strings.HasSuffix(seg, s.suffix) {
+					return true
+				}
+			}
+		}
+	}
+
+	for _, p := range c.globs {
+		if p.directory && !isDir {
+			continue
+		}
+		if p.regex.MatchString(rel) {
+			return true
+		}
+	}
+	return false
+}
+
+// ignoreCompileCache memoizes compiled .gitignore files across walks, keyed
+// by path. Entries are revalidated by mtime+size, so a watch loop polling the
+// same tree every 500ms pays the parse cost once.
+var ignoreCompileCache sync.Map // string → *cachedIgnore
+
+type cachedIgnore struct {
+	modTime int64
+	size    int64
+	rules   *compiledIgnore
+}
+
+// loadCompiledIgnore reads and compiles dir/.gitignore, or returns nil when
+// the directory has none.
+func loadCompiledIgnore(dir string) *compiledIgnore {
+	path := filepath.Join(dir, ".gitignore")
+	info, err := os.Stat(path)
+	if err != nil || info.IsDir() {
+		return nil
+	}
+
+	if v, ok := ignoreCompileCache.Load(path); ok {
+		cached := v.(*cachedIgnore)
+		if cached.modTime == info.ModTime().UnixNano() && cached.size == info.Size() {
+			return cached.rules
+		}
+	}
+
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil
+	}
+	rules := compileIgnore(string(data))
+	ignoreCompileCache.Store(path, &cachedIgnore{
+		modTime: info.ModTime().UnixNano(),
+		size:    info.Size(),
+		rules:   rules,
+	})
+	return rules
+}
+
+// ignoreStack is one scope in a per-directory stack of .gitignore files. The
+// stack is an immutable linked list, so concurrent walk branches can push
+// their own scopes without locking; the directory verdict cache at the root
+// is shared by every branch.
+type ignoreStack struct {
+	parent *ignoreStack
+	prefix string // path of this scope relative to the walk root ("" for root)
+	rules  *compiledIgnore
+
+	verdicts *sync.Map // rel dir path → bool, shared across the whole stack
+}
+
+// newIgnoreStack creates the root scope for a walk, compiling root/.gitignore
+// if present.
+func newIgnoreStack(root string) *ignoreStack {
+	return &ignoreStack{
+		rules:    loadCompiledIgnore(root),
+		verdicts: &sync.Map{},
+	}
+}
+
+// push enters a subdirectory: if it carries its own .gitignore a new scope is
+// stacked on top, otherwise the current stack is reused as-is.
+func (s *ignoreStack) push(relDir, absDir string) *ignoreStack {
+	rules := loadCompiledIgnore(absDir)
+	if rules.empty() {
+		return s
+	}
+	return &ignoreStack{
+		parent:   s,
+		prefix:   relDir,
+		rules:    rules,
+		verdicts: s.verdicts,
+	}
+}
+
+// ignored reports whether rel (relative to the walk root) is covered by any
+// scope on the stack. Directory verdicts are memoized so re-walks of the same
+// tree decide pruned directories in O(1).
+func (s *ignoreStack) ignored(rel string, isDir bool) bool {
+	if isDir {
+		if v, ok := s.verdicts.Load(rel); ok {
+			return v.(bool)
+		}
+	}
+
+	matched := false
+	for scope := s; scope != nil; scope = scope.parent {
+		scoped := rel
+		if scope.prefix != "" {
+			if !strings.HasPrefix(rel, scope.prefix+"/") {
+				continue
+			}
+			scoped = rel[len(scope.prefix)+1:]
+		}
+		if scope.rules.match(scoped, isDir) {
+			matched = true
+			break
+		}
+	}
+
+	if isDir {
+		s.verdicts.Store(rel, matched)
+	}
+	return matched
+}
+
+// IgnoreMatcher handles .gitignore pattern matching for the serial walkers
+// (CollectSourceFiles and friends). It compiles the root .gitignore only;
+// the parallel walk in walkFiles additionally stacks nested .gitignore files
+// via ignoreStack.
+type IgnoreMatcher struct {
+	root  string
+	stack *ignoreStack
+}
+
+func NewIgnoreMatcher(root string) *IgnoreMatcher {
+	return &IgnoreMatcher{
+		root:  root,
+		stack: newIgnoreStack(root),
+	}
+}
+
+// Matches reports whether the path (relative to root) is ignored.
+func (m *IgnoreMatcher) Matches(path string, isDir bool) bool {
+	return m.stack.ignored(path, isDir)
+}
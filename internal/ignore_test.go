@@ -0,0 +1,131 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+// TestCompileIgnore_Buckets: каждая форма паттерна должна попадать в свой
+// бакет и матчиться так же, как старый regex-движок.
+func TestCompileIgnore_Buckets(t *testing.T) {
+	c := compileIgnore("vendor\nbuild/\n*.log\n/docs\na/b\n**/gen\n!keep.log\n# comment\n")
+
+	if len(c.names) != 2 {
+		t.Errorf("names = %v, want vendor and build", c.names)
+	}
+	if len(c.suffixes) != 1 || c.suffixes[0].suffix != ".log" {
+		t.Errorf("suffixes = %v, want [.log]", c.suffixes)
+	}
+	if len(c.paths) != 1 {
+		t.Errorf("paths = %v, want /docs only", c.paths)
+	}
+	if len(c.globs) != 2 {
+		t.Errorf("globs = %d patterns, want 2 (a/b and **/gen)", len(c.globs))
+	}
+
+	cases := []struct {
+		path  string
+		isDir bool
+		want  bool
+	}{
+		{"vendor", true, true},
+		{"vendor/pkg.go", false, true}, // segment match, files included
+		{"build", true, true},
+		{"build/out.bin", false, false}, // dir-only pattern matches the dir itself
+		{"app.log", false, true},
+		{"src/app.log", false, true},
+		{"docs", true, true},
+		{"src/docs", true, false}, // anchored: only the root-level docs
+		{"a/b", false, true},
+		{"x/a/b", false, true},
+		{"deep/gen", true, true},
+		{"main.go", false, false},
+	}
+	for _, tc := range cases {
+		if got := c.match(tc.path, tc.isDir); got != tc.want {
+			t.Errorf("match(%q, isDir=%v) = %v, want %v", tc.path, tc.isDir, got, tc.want)
+		}
+	}
+}
+
+// TestIgnoreStack_NestedGitignore: вложенный .gitignore действует только в
+// своём поддереве и накладывается поверх корневого.
+func TestIgnoreStack_NestedGitignore(t *testing.T) {
+	root := t.TempDir()
+	sub := filepath.Join(root, "sub")
+	if err := os.MkdirAll(sub, 0755); err != nil {
+		t.Fatalf("MkdirAll() error = %v", err)
+	}
+	if err := os.WriteFile(filepath.Join(root, ".gitignore"), []byte("*.log\n"), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+	if err := os.WriteFile(filepath.Join(sub, ".gitignore"), []byte("generated\n"), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+
+	stack := newIgnoreStack(root).push("sub", sub)
+
+	if !stack.ignored("sub/app.log", false) {
+		t.Error("root *.log rule should still apply inside sub/")
+	}
+	if !stack.ignored("sub/generated", true) {
+		t.Error("nested rule should ignore sub/generated")
+	}
+	if newIgnoreStack(root).ignored("generated", true) {
+		t.Error("nested rule must not leak to the root scope")
+	}
+
+	// Повторный запрос каталога должен прийти из кэша вердиктов
+	if v, ok := stack.verdicts.Load("sub/generated"); !ok || v.(bool) != true {
+		t.Error("directory verdict was not memoized")
+	}
+}
+
+// TestWalkFiles_RespectsNestedGitignore: параллельный обход должен подхватить
+// .gitignore подкаталога и не эмитить его файлы.
+func TestWalkFiles_RespectsNestedGitignore(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	root := t.TempDir()
+	sub := filepath.Join(root, "sub")
+	gen := filepath.Join(sub, "generated")
+	if err := os.MkdirAll(gen, 0755); err != nil {
+		t.Fatalf("MkdirAll() error = %v", err)
+	}
+	files := map[string]string{
+		filepath.Join(root, "main.go"):   "package p\n\nfunc A() {\n}\n",
+		filepath.Join(sub, "lib.go"):     "package p\n\nfunc B() {\n}\n",
+		filepath.Join(gen, "skipped.go"): "package p\n\nfunc C() {\n}\n",
+	}
+	for path, content := range files {
+		if err := os.WriteFile(path, []byte(content), 0644); err != nil {
+			t.Fatalf("WriteFile() error = %v", err)
+		}
+	}
+	if err := os.WriteFile(filepath.Join(sub, ".gitignore"), []byte("generated/\n"), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+
+	dp := NewDirProcessor(config, 2, true, true, "functions")
+	jobs, err := dp.collectFiles(root)
+	if err != nil {
+		t.Fatalf("collectFiles() error = %v", err)
+	}
+
+	var paths []string
+	for _, job := range jobs {
+		paths = append(paths, job.Path)
+	}
+	if len(jobs) != 2 {
+		t.Fatalf("collectFiles() = %v, want main.go and sub/lib.go only", paths)
+	}
+	for _, p := range paths {
+		if filepath.Base(p) == "skipped.go" {
+			t.Errorf("file under nested-ignored directory was emitted: %s", p)
+		}
+	}
+}
@@ -98,6 +98,8 @@ func BuildShardGraph(
 		}
 	}
 
+	resolver := newShardResolver(rootDir, modulePrefix, aliasMap, relToShard)
+
 	for absPath, imports := range fileImports {
 		srcKey := ShardKeyForPath(absPath, rootDir, splitBy)
 		srcShard := PathToShardName(srcKey)
@@ -107,7 +109,7 @@ func BuildShardGraph(
 		}
 
 		for _, imp := range imports {
-			dstShard, resolvable := resolveImportToShard(imp, absPath, rootDir, modulePrefix, aliasMap, relToShard)
+			dstShard, resolvable := resolver.resolve(imp, absPath)
 			if resolvable {
 				stats.Resolvable++
 				if dstShard != "" {
@@ -123,65 +125,123 @@ func BuildShardGraph(
 	return graph, stats
 }
 
-// resolveImportToShard maps one import string to a shard name ("" if the
-// import is external / cannot be resolved). The second return value reports
-// whether imp *looked* like an intra-project import worth counting toward
+// resolveKey identifies one resolution question. srcDir is "" for absolute
+// and alias imports — their answer doesn't depend on where the import appears
+// — so a specifier seen in ten thousand files costs one cache entry, not ten
+// thousand.
+type resolveKey struct {
+	imp    string
+	srcDir string
+}
+
+type resolveResult struct {
+	shard      string
+	resolvable bool
+}
+
+// shardResolver maps import strings to shard names for one BuildShardGraph
+// run. Two things make it fast on large trees: every answer is memoized under
+// a resolveKey (external specifiers like "lodash" recur tens of thousands of
+// times and hit the cache after first sight), and directory lookups go
+// through dirToShard, built once, instead of scanning relToShard per import.
+type shardResolver struct {
+	rootDir      string
+	modulePrefix string
+	aliasMap     map[string]string
+	relToShard   map[string]string
+	dirToShard   map[string]string
+	cache        map[resolveKey]resolveResult
+}
+
+func newShardResolver(rootDir, modulePrefix string, aliasMap, relToShard map[string]string) *shardResolver {
+	// Index: immediate containing directory (slash, "." for the root) → shard.
+	// When splitBy=file puts several shards in one directory, the
+	// lexicographically smallest file wins so the answer is deterministic.
+	dirToShard := make(map[string]string, len(relToShard))
+	winner := make(map[string]string, len(relToShard))
+	for rel, shard := range relToShard {
+		dir := filepath.ToSlash(filepath.Dir(rel))
+		if prev, ok := winner[dir]; !ok || rel < prev {
+			winner[dir] = rel
+			dirToShard[dir] = shard
+		}
+	}
+	return &shardResolver{
+		rootDir:      rootDir,
+		modulePrefix: modulePrefix,
+		aliasMap:     aliasMap,
+		relToShard:   relToShard,
+		dirToShard:   dirToShard,
+		cache:        make(map[resolveKey]resolveResult),
+	}
+}
+
+// resolve maps one import string to a shard name ("" if the import is
+// external / cannot be resolved). The second return value reports whether imp
+// *looked* like an intra-project import worth counting toward
 // ShardGraphStats — true for a modulePrefix/alias/relative match regardless
 // of whether resolution actually succeeded, false for anything that was
 // never a candidate (an external package import, for instance).
-func resolveImportToShard(
-	imp, srcFile, rootDir, modulePrefix string,
-	aliasMap map[string]string,
-	relToShard map[string]string,
-) (string, bool) {
+func (r *shardResolver) resolve(imp, srcFile string) (string, bool) {
+	key := resolveKey{imp: imp}
+	if strings.HasPrefix(imp, ".") {
+		// Only relative imports depend on the importing file's directory.
+		key.srcDir = filepath.Dir(srcFile)
+	}
+	if res, ok := r.cache[key]; ok {
+		return res.shard, res.resolvable
+	}
+	shard, resolvable := r.resolveUncached(imp, key.srcDir)
+	r.cache[key] = resolveResult{shard: shard, resolvable: resolvable}
+	return shard, resolvable
+}
+
+func (r *shardResolver) resolveUncached(imp, srcDir string) (string, bool) {
 	// --- Go-style: strip module prefix ---
-	if modulePrefix != "" && strings.HasPrefix(imp, modulePrefix) {
-		rel := strings.TrimPrefix(imp, modulePrefix)
+	if r.modulePrefix != "" && strings.HasPrefix(imp, r.modulePrefix) {
+		rel := strings.TrimPrefix(imp, r.modulePrefix)
 		rel = strings.TrimPrefix(rel, "/")
-		return shardForDir(rel, relToShard), true
+		return r.shardForDir(rel), true
 	}
 
 	// --- Path alias (e.g. @/ → src/) ---
-	if aliasMap != nil {
-		for prefix, target := range aliasMap {
-			if strings.HasPrefix(imp, prefix) {
-				rel := filepath.ToSlash(target) + strings.TrimPrefix(imp, prefix)
-				rel = strings.TrimSuffix(rel, "/")
-				for _, candidate := range candidatePaths(filepath.Join(rootDir, filepath.FromSlash(rel))) {
-					r, err := filepath.Rel(rootDir, candidate)
-					if err == nil {
-						if shard, ok := relToShard[filepath.ToSlash(r)]; ok {
-							return shard, true
-						}
+	for prefix, target := range r.aliasMap {
+		if strings.HasPrefix(imp, prefix) {
+			rel := filepath.ToSlash(target) + strings.TrimPrefix(imp, prefix)
+			rel = strings.TrimSuffix(rel, "/")
+			for _, candidate := range candidatePaths(filepath.Join(r.rootDir, filepath.FromSlash(rel))) {
+				cr, err := filepath.Rel(r.rootDir, candidate)
+				if err == nil {
+					if shard, ok := r.relToShard[filepath.ToSlash(cr)]; ok {
+						return shard, true
 					}
 				}
-				return shardForDir(rel, relToShard), true
 			}
+			return r.shardForDir(rel), true
 		}
 	}
 
 	// --- Relative import (Python / JS / TS) ---
 	if strings.HasPrefix(imp, ".") {
-		srcDir := filepath.Dir(srcFile)
 		// Normalise Python "from .foo import bar" → "foo"
 		cleaned := strings.TrimLeft(imp, ".")
 		cleaned = strings.ReplaceAll(cleaned, ".", string(filepath.Separator))
 		abs := filepath.Join(srcDir, cleaned)
 		// Try exact match and with common extensions
 		for _, candidate := range candidatePaths(abs) {
-			rel, err := filepath.Rel(rootDir, candidate)
+			rel, err := filepath.Rel(r.rootDir, candidate)
 			if err != nil {
 				continue
 			}
 			relSlash := filepath.ToSlash(rel)
-			if shard, ok := relToShard[relSlash]; ok {
+			if shard, ok := r.relToShard[relSlash]; ok {
 				return shard, true
 			}
 		}
 		// Fallback: treat cleaned path as a directory
-		rel, err := filepath.Rel(rootDir, abs)
+		rel, err := filepath.Rel(r.rootDir, abs)
 		if err == nil {
-			return shardForDir(filepath.ToSlash(rel), relToShard), true
+			return r.shardForDir(filepath.ToSlash(rel)), true
 		}
 		return "", true
 	}
@@ -196,19 +256,16 @@ func resolveImportToShard(
 // own import). A plain string-prefix match (dirRel + "/") would also match
 // a subpackage's files, e.g. resolving an import of "internal" into a file
 // that actually lives in "internal/knowledge/" — a distinct package with its
-// own shard — because relToShard's iteration order is unspecified, this
-// silently and non-deterministically dropped the edge to the correct
-// shallower shard whenever a file also imported both a package and one of
-// its subpackages.
-func shardForDir(dirRel string, relToShard map[string]string) string {
+// own shard — which silently and non-deterministically dropped the edge to
+// the correct shallower shard whenever a file also imported both a package
+// and one of its subpackages. The lookup goes through the dirToShard index
+// built in newShardResolver.
+func (r *shardResolver) shardForDir(dirRel string) string {
 	dirRel = filepath.ToSlash(dirRel)
-	for rel, shard := range relToShard {
-		relDir := filepath.ToSlash(filepath.Dir(rel))
-		if relDir == dirRel || (dirRel == "" && relDir == ".") {
-			return shard
-		}
+	if dirRel == "" {
+		dirRel = "."
 	}
-	return ""
+	return r.dirToShard[dirRel]
 }
 
 // candidatePaths returns likely file paths for an import without extension.
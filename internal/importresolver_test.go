@@ -154,3 +154,54 @@ func TestBuildShardGraph_ParentAndSubpackageBothResolve(t *testing.T) {
 		}
 	}
 }
+
+// TestShardResolver_CachesRepeatedImports verifies the memoization contract:
+// an absolute specifier ("lodash", a module-prefix import) is keyed without
+// the importing directory, so seeing it from many files costs one cache
+// entry, while relative imports are keyed per source directory because their
+// answer genuinely differs.
+func TestShardResolver_CachesRepeatedImports(t *testing.T) {
+	relToShard := map[string]string{
+		"pkg/a.go": "pkg.json",
+		"app/b.go": "app.json",
+	}
+	r := newShardResolver("/proj", "example.com/m/", nil, relToShard)
+
+	for _, src := range []string{"/proj/app/b.go", "/proj/pkg/a.go", "/proj/pkg/a.go"} {
+		shard, ok := r.resolve("example.com/m/pkg", src)
+		if shard != "pkg.json" || !ok {
+			t.Fatalf("resolve(pkg) from %s = (%q, %v)", src, shard, ok)
+		}
+		if shard, ok := r.resolve("lodash", src); shard != "" || ok {
+			t.Fatalf("resolve(lodash) from %s = (%q, %v), want external", src, shard, ok)
+		}
+	}
+	// One entry each for the module import and the external specifier.
+	if len(r.cache) != 2 {
+		t.Errorf("cache has %d entries, want 2: %v", len(r.cache), r.cache)
+	}
+
+	r.resolve("./a", "/proj/pkg/x.go")
+	r.resolve("./b", "/proj/app/x.go")
+	if len(r.cache) != 4 {
+		t.Errorf("cache has %d entries after relative imports, want 4", len(r.cache))
+	}
+}
+
+// TestShardResolver_DirIndexDeterministicPerFileShards: with --split-by file
+// several shards share one directory; a directory-level import must resolve
+// to the same shard every run (the lexicographically smallest file wins),
+// not whichever map iteration order produced.
+func TestShardResolver_DirIndexDeterministicPerFileShards(t *testing.T) {
+	relToShard := map[string]string{
+		"pkg/a.go": "pkg_a.json",
+		"pkg/b.go": "pkg_b.json",
+		"pkg/c.go": "pkg_c.json",
+	}
+	for i := 0; i < 20; i++ {
+		r := newShardResolver("/proj", "example.com/m/", nil, relToShard)
+		if shard := r.shardForDir("pkg"); shard != "pkg_a.json" {
+			t.Fatalf("run %d: shardForDir(pkg) = %q, want pkg_a.json", i, shard)
+		}
+	}
+}
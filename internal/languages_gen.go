@@ -0,0 +1,383 @@
+// Code generated by gen_languages.go from languages.json; DO NOT EDIT.
+
+package internal
+
+func init() {
+	builtinConfig = Config{
+		"c": {
+			Name:         "C",
+			Extensions:   []string{".c", ".h"},
+			FuncPattern:  "^\\s*[\\w\\s\\*]+\\s+({IDENT}+)\\s*\\([^)]*\\)\\s*$",
+			ClassPattern: "^\\s*(?:typedef\\s+)?struct\\s+(?:\\w+\\s*)?\\{",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "struct", Pattern: "^\\s*(?:typedef\\s+)?(?:struct|union)\\s+(?:({IDENT}+)\\s*)?\\{"},
+				{Type: "typedef_struct", Pattern: "^\\s*typedef\\s+struct(?:\\s+\\w+)?\\s*\\{\\s*({IDENT}+)\\s*\\}"},
+			},
+			FieldPattern:      "^\\s*([a-zA-Z_][a-zA-Z0-9_]*)\\s*\\s*([a-zA-Z_][\\w\\s\\*\\[\\]]*)\\s*;",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "switch", "case", "return", "sizeof", "define", "include", "ifdef", "ifndef", "endif"},
+			ImportPattern:     "^\\s*#\\s*include\\s*[<\"]([^>\"]+)[>\"]",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\"", "'"},
+			RawStringChars:    []string{},
+			EscapeChar:        "\\",
+			LangKey:           "c",
+		},
+		"cpp": {
+			Name:         "C++",
+			Extensions:   []string{".cpp", ".cc", ".cxx", ".hpp", ".h"},
+			FuncPattern:  "^\\s*[\\w\\s\\*:<>,]+\\s+({IDENT}+)\\s*\\([^)]*\\)\\s*(const)?\\s*$",
+			ClassPattern: "^\\s*(?:[\\w\\s]+\\s+)?(?:class|struct)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*(?:\\w+\\s+)?class\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:\\w+\\s+)?enum\\s+(?:class\\s+)?({IDENT}+)"},
+				{Type: "interface", Pattern: "^\\s*(?:\\w+\\s+)?class\\s+({IDENT}+)\\s*:"},
+				{Type: "struct", Pattern: "^\\s*(?:\\w+\\s+)?struct\\s+({IDENT}+)"},
+				{Type: "union", Pattern: "^\\s*(?:\\w+\\s+)?union\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "^\\s*(?:const\\s+)?(?:\\w+(?:<[^>]*>)?\\s+)+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?:\\[\\s*\\]\\s*)?(?:=|;|,)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "switch", "case", "return", "sizeof", "define", "include", "typedef", "namespace", "using"},
+			ImportPattern:     "^\\s*#\\s*include\\s*[<\"]([^>\"]+)[>\"]",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\"", "'"},
+			RawStringChars:    []string{},
+			EscapeChar:        "\\",
+			LangKey:           "cpp",
+		},
+		"cs": {
+			Name:         "C#",
+			Extensions:   []string{".cs", ".csx"},
+			FuncPattern:  "^\\s*[\\w\\s\\*<>,\\[\\]]+\\s+({IDENT}+)\\s*\\([^)]*\\)\\s*$",
+			ClassPattern: "^\\s*(?:[\\w\\s]+\\s+)?(?:class|interface|struct|enum)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*(?:(?:public|private|protected|internal|static|abstract|sealed|partial)\\s+)*(?:class|record)\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?enum\\s+({IDENT}+)"},
+				{Type: "interface", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?interface\\s+({IDENT}+)"},
+				{Type: "record", Pattern: "^\\s*(?:(?:public|private|protected|internal|sealed)\\s+)?record\\s+(?:struct\\s+)?({IDENT}+)"},
+				{Type: "struct", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?struct\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "^\\s*(?:public|private|protected|internal|static|readonly|const|volatile)?\\s*(?:readonly\\s+)?(?:[a-zA-Z_][\\w<>\\.\\[\\]]*)\\s+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?:\\{|=|;)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "foreach", "for", "switch", "case", "return", "using", "namespace", "class", "interface", "struct", "enum"},
+			DecoratorPattern:  "^\\s*\\[(\\w+)",
+			ImportPattern:     "^\\s*using\\s+([\\w.]+)",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{"@\""},
+			EscapeChar:        "\\",
+			CharDelimiters:    []string{"'"},
+			LangKey:           "cs",
+		},
+		"d": {
+			Name:         "D",
+			Extensions:   []string{".d"},
+			FuncPattern:  "^\\s*[\\w\\s\\*\\[\\]]+\\s+({IDENT}+)\\s*\\([^)]*\\)\\s*$",
+			ClassPattern: "^\\s*(?:[\\w\\s]+\\s+)?(?:class|struct|interface|enum)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*(?:(?:public|private|protected|static|const|immutable|shared)\\s+)*class\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:(?:public|private|protected|static|const)\\s+)?enum\\s+({IDENT}+)"},
+				{Type: "interface", Pattern: "^\\s*(?:(?:public|private|protected)\\s+)?interface\\s+({IDENT}+)"},
+				{Type: "struct", Pattern: "^\\s*(?:(?:public|private|protected|static|const|immutable|shared)\\s+)*struct\\s+({IDENT}+)"},
+				{Type: "union", Pattern: "^\\s*(?:(?:public|private|protected|static|const)\\s+)?union\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "^\\s*(?:public|private|protected|package|static|const|immutable|shared|enum)\\s*(?:[a-zA-Z_][\\w\\[\\]]*)\\s+([a-zA-Z_][a-zA-Z0-9_]*)\\s*;",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "foreach", "for", "switch", "case", "return", "import", "module", "class", "struct", "interface", "enum", "union"},
+			ImportPattern:     "^\\s*import\\s+([\\w.]+)",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{"`", "r\""},
+			EscapeChar:        "\\",
+			CharDelimiters:    []string{"'"},
+			LangKey:           "d",
+		},
+		"go": {
+			Name:         "Go",
+			Extensions:   []string{".go"},
+			FuncPattern:  "^\\s*func\\s+(\\([^)]*\\)\\s+)?({IDENT}+)(?:\\[[^\\]]*\\])?\\s*\\(",
+			ClassPattern: "^\\s*type\\s+({IDENT}+)\\s+(struct|interface)\\s*\\{",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "interface", Pattern: "^\\s*type\\s+({IDENT}+)\\s+interface\\s*\\{"},
+				{Type: "named", Pattern: "^\\s*type\\s+({IDENT}+)\\s+[^={\\s](?:.*[^{])?\\s*$"},
+				{Type: "struct", Pattern: "^\\s*type\\s+({IDENT}+)\\s+struct\\s*\\{"},
+				{Type: "type_alias", Pattern: "^\\s*type\\s+({IDENT}+)\\s*=\\s*"},
+			},
+			FieldPattern:      "^\\s*([a-zA-Z_][a-zA-Z0-9_]*)\\s+([a-zA-Z_][\\w\\[\\]*\\s]*)\\s*$",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"func", "type", "import", "const", "var", "package"},
+			ImportPattern:     "^\\s*(?:import\\s+\"([^\"]+)\"|\"([^\"]+)\"$)",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{"`"},
+			EscapeChar:        "\\",
+			CharDelimiters:    []string{"'"},
+			SupportsNested:    true,
+			LangKey:           "go",
+		},
+		"java": {
+			Name:         "Java",
+			Extensions:   []string{".java"},
+			FuncPattern:  "^\\s*[\\w\\s\\*<>,\\[\\]]+\\s+({IDENT}+)\\s*\\([^)]*\\)\\s*(throws\\s+[\\w,\\s]+)?\\s*\\{?\\s*$",
+			ClassPattern: "^\\s*(?:[\\w\\s]+\\s+)?(?:class|interface|enum)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "abstract", Pattern: "^\\s*(?:(?:public|private|protected|static|abstract)\\s+)*abstract\\s+class\\s+({IDENT}+)"},
+				{Type: "class", Pattern: "^\\s*(?:(?:public|private|protected|static|abstract|final|sealed|non-sealed)\\s+)*(?:class|record)\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:(?:public|private|protected|static)\\s+)?enum\\s+({IDENT}+)"},
+				{Type: "interface", Pattern: "^\\s*(?:(?:public|private|protected|static)\\s+)?interface\\s+({IDENT}+)"},
+				{Type: "record", Pattern: "^\\s*(?:(?:public|private|protected|static)\\s+)?record\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "^\\s*(?:public|private|protected|static|final|abstract|synchronized|native|strictfp)?\\s*(?:final\\s+)?(?:[a-zA-Z_][\\w<>[\\]]*)\\s+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?:=|;)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "switch", "case", "return", "import", "package", "class", "interface", "enum"},
+			DecoratorPattern:  "^\\s*@(\\w+)",
+			ImportPattern:     "^\\s*import\\s+(?:static\\s+)?([\\w.]+)",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{},
+			EscapeChar:        "\\",
+			CharDelimiters:    []string{"'"},
+			LangKey:           "java",
+		},
+		"js": {
+			Name:         "JavaScript",
+			Extensions:   []string{".js", ".jsx", ".mjs"},
+			FuncPattern:  "^\\s*(?:(export\\s+)?(async\\s+)?function\\s*\\*?\\s+({IDENT}+)\\s*\\(|(?:export\\s+)?(const|let|var)\\s+({IDENT}+)\\s*=\\s*(async\\s+)?\\()",
+			ClassPattern: "^\\s*(?:export\\s+)?class\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*(?:export\\s+)?(?:abstract\\s+)?class\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:export\\s+)?const\\s+({IDENT}+)\\s*=\\s*\\{"},
+				{Type: "interface", Pattern: "^\\s*(?:export\\s+)?interface\\s+({IDENT}+)"},
+				{Type: "type_alias", Pattern: "^\\s*(?:export\\s+)?type\\s+({IDENT}+)\\s*="},
+			},
+			FieldPattern:      "(?:(?:public|private|protected|readonly|static|abstract)\\s+)*(?:[a-zA-Z_][\\w\\[\\]]*)\\s+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?:=|;|,)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "switch", "case", "return", "typeof", "instanceof", "new", "delete", "void", "await", "async", "export", "import", "default"},
+			ImportPattern:     "^\\s*(?:import\\s+.*?from\\s+[\"']([^\"']+)[\"']|require\\s*\\(\\s*[\"']([^\"']+)[\"'])",
+			ExcludePatterns:   []string{"^\\.", "^\\./"},
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\"", "'"},
+			RawStringChars:    []string{"`"},
+			EscapeChar:        "\\",
+			SupportsNested:    true,
+			LangKey:           "js",
+		},
+		"kotlin": {
+			Name:         "Kotlin",
+			Extensions:   []string{".kt", ".kts"},
+			FuncPattern:  "^\\s*(?:(?:public|private|protected|internal)\\s+)?(?:suspend\\s+)?fun\\s+(?:<[^>]+>\\s+)?({IDENT}+)\\s*\\(",
+			ClassPattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?(?:data\\s+|sealed\\s+|enum\\s+|abstract\\s+)?(?:class|interface|object)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?(?:open\\s+)?(?:abstract\\s+)?(?:data\\s+)?(?:sealed\\s+)?class\\s+({IDENT}+)"},
+				{Type: "data_class", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?data\\s+class\\s+({IDENT}+)"},
+				{Type: "enum_class", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?enum\\s+class\\s+({IDENT}+)"},
+				{Type: "interface", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?interface\\s+({IDENT}+)"},
+				{Type: "object", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?object\\s+({IDENT}+)"},
+				{Type: "sealed_class", Pattern: "^\\s*(?:(?:public|private|protected|internal)\\s+)?sealed\\s+class\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "(?:var|val|public|private|protected|internal|static|lateinit)\\s+(?:\\w+(?:<[^>]*>)?\\s+)+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?::\\s*[\\w\\[\\]<>?,=\\s]*)?(?:\\{|=|;)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "when", "switch", "return", "fun", "class", "interface", "object", "data", "sealed", "enum", "val", "var", "import", "package"},
+			DecoratorPattern:  "^\\s*@(\\w+)",
+			ImportPattern:     "^\\s*import\\s+([\\w.]+)",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{"\"\"\""},
+			EscapeChar:        "\\",
+			CharDelimiters:    []string{"'"},
+			LangKey:           "kotlin",
+		},
+		"php": {
+			Name:         "PHP",
+			Extensions:   []string{".php"},
+			FuncPattern:  "^\\s*(?:(?:public|private|protected)\\s+)?(?:static\\s+)?function\\s+({IDENT}+)\\s*\\(",
+			ClassPattern: "^\\s*(?:(?:abstract|final)\\s+)?(?:class|interface|trait)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "abstract", Pattern: "^\\s*abstract\\s+class\\s+({IDENT}+)"},
+				{Type: "class", Pattern: "^\\s*(?:abstract\\s+|final\\s+)*(?:public\\s+|private\\s+|protected\\s+)*class\\s+({IDENT}+)"},
+				{Type: "interface", Pattern: "^\\s*(?:public\\s+|private\\s+|protected\\s+)*interface\\s+({IDENT}+)"},
+				{Type: "trait", Pattern: "^\\s*(?:public\\s+|private\\s+|protected\\s+)*trait\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "(?:public|private|protected|var|static)\\s+(?:\\$\\w+(?:<[^>]*>)?\\s*,?\\s*)+",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "foreach", "for", "switch", "case", "return", "echo", "print", "class", "interface", "trait", "function", "public", "private", "protected", "static"},
+			ImportPattern:     "^\\s*(?:use\\s+([\\w\\\\]+)|require(?:_once)?\\s*[\"']([^\"']+)[\"']|include(?:_once)?\\s*[\"']([^\"']+)[\"'])",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\"", "'"},
+			RawStringChars:    []string{},
+			EscapeChar:        "\\",
+			LangKey:           "php",
+		},
+		"py": {
+			Name:         "Python",
+			Extensions:   []string{".py", ".pyw"},
+			FuncPattern:  "^\\s*(async\\s+)?def\\s+({IDENT}+)\\s*\\(",
+			ClassPattern: "^\\s*class\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "NamedTuple", Pattern: "^\\s*class\\s+({IDENT}+)\\s*\\(\\s*NamedTuple\\s*\\)"},
+				{Type: "Protocol", Pattern: "^\\s*class\\s+({IDENT}+)\\s*\\(\\s*Protocol\\s*\\)"},
+				{Type: "TypedDict", Pattern: "^\\s*class\\s+({IDENT}+)\\s*\\(\\s*TypedDict\\s*\\)"},
+				{Type: "abstract", Pattern: "^\\s*class\\s+({IDENT}+)\\s*\\(\\s*ABC\\s*\\)"},
+				{Type: "attrs", Pattern: "^\\s*@attr\\.s\\s*\\nclass\\s+({IDENT}+)"},
+				{Type: "class", Pattern: "^\\s*class\\s+({IDENT}+)"},
+				{Type: "dataclass", Pattern: "^\\s*@dataclass\\s*\\nclass\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*class\\s+({IDENT}+)\\s*\\(\\s*Enum\\s*\\)"},
+			},
+			FieldPattern:     "^\\s*(\\w+)\\s*:\\s*([\\w\\[\\],\\.\\s\\*]*?)\\s*(?:=|$)",
+			CallPattern:      "({IDENT}+)\\s*\\(",
+			ExcludeWords:     []string{"def", "class", "if", "else", "elif", "while", "for", "try", "except", "finally", "with", "return", "yield", "import", "from", "pass", "break", "continue"},
+			DecoratorPattern: "^\\s*@(\\w+)",
+			ImportPattern:    "^\\s*(?:from\\s+(\\S+)\\s+import|import\\s+(\\S+))",
+			ExcludePatterns:  []string{"^\\.", "^\\.\\.", "^__future__"},
+			LineComment:      "#",
+			StringChars:      []string{"\"", "'"},
+			RawStringChars:   []string{"r\"", "r'"},
+			EscapeChar:       "\\",
+			DocStringMarkers: []string{"\"\"\"", "'''"},
+			IndentBased:      true,
+			SupportsNested:   true,
+			LangKey:          "py",
+		},
+		"ruby": {
+			Name:         "Ruby",
+			Extensions:   []string{".rb", ".rake"},
+			FuncPattern:  "^\\s*def\\s+({IDENT}+[?!]?)\\s*[\\(\\n]?",
+			ClassPattern: "^\\s*(?:class|module)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*class\\s+({IDENT}+)"},
+				{Type: "data", Pattern: "^\\s*Data\\.define\\s*\\(\\s*\"({IDENT}+)\""},
+				{Type: "module", Pattern: "^\\s*module\\s+({IDENT}+)"},
+				{Type: "struct", Pattern: "^\\s*Struct\\.new\\s*\\(\\s*\"({IDENT}+)\""},
+			},
+			FieldPattern:      "^\\s*(?:attr_reader|attr_writer|attr_accessor)?\\s*(?:\\w+)\\s*[,|\\s]",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "elsif", "else", "unless", "while", "until", "for", "case", "when", "return", "yield", "class", "module", "def", "end"},
+			ImportPattern:     "^\\s*require(?:_relative)?\\s*[\"']([^\"']+)[\"']",
+			LineComment:       "#",
+			BlockCommentStart: "=begin",
+			BlockCommentEnd:   "=end",
+			StringChars:       []string{"\"", "'"},
+			RawStringChars:    []string{"%q{", "%Q{"},
+			EscapeChar:        "\\",
+			BlockEndKeyword:   "end",
+			SupportsNested:    true,
+			LangKey:           "ruby",
+		},
+		"rust": {
+			Name:         "Rust",
+			Extensions:   []string{".rs"},
+			FuncPattern:  "^\\s*(?:pub\\s+)?(?:pub\\(crate\\)\\s+)?(?:async\\s+)?(?:unsafe\\s+)?(?:const\\s+)?(?:extern\\s+(?:\"C\"\\s+)?)?fn\\s+({IDENT}+)\\s*(?:<[^>]*>)?\\s*\\(",
+			ClassPattern: "^\\s*(?:pub\\s+)?(?:pub\\(crate\\)\\s+)?(?:struct|trait|enum|impl)(?:\\s+<[^>]*>)?\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "enum", Pattern: "^\\s*(?:pub\\s+)?(?:pub\\(crate\\)\\s+)?enum\\s+({IDENT}+)"},
+				{Type: "struct", Pattern: "^\\s*(?:pub\\s+)?(?:pub\\(crate\\)\\s+)?struct\\s+({IDENT}+)"},
+				{Type: "trait", Pattern: "^\\s*(?:pub\\s+)?(?:pub\\(crate\\)\\s+)?trait\\s+({IDENT}+)"},
+				{Type: "union", Pattern: "^\\s*(?:pub\\s+)?(?:pub\\(crate\\)\\s+)?union\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "^\\s*(?:pub\\s+)?(?:pub\\(crate\\)\\s+)?(?:const\\s+)?(?:static\\s+)?(?:mut\\s+)?([a-zA-Z_][a-zA-Z0-9_]*)\\s*:(?:\\s*<[^>]*>\\s*)?\\s*[a-zA-Z_][\\w<>,\\[\\]\\s]*",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "loop", "match", "return", "break", "continue", "unsafe", "fn", "struct", "enum", "trait", "impl", "pub", "mod", "use"},
+			ImportPattern:     "^\\s*use\\s+([^;]+)",
+			ExcludePatterns:   []string{"^super::", "^self::"},
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{"r#\"", "r#*[^\"]*#*"},
+			EscapeChar:        "\\",
+			LangKey:           "rust",
+		},
+		"scala": {
+			Name:         "Scala",
+			Extensions:   []string{".scala"},
+			FuncPattern:  "^\\s*(?:(?:private|protected|public)\\s+)?def\\s+({IDENT}+)\\s*[\\[\\(]",
+			ClassPattern: "^\\s*(?:(?:private|protected|public)\\s+)?(?:case\\s+)?(?:class|object|trait)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "case_class", Pattern: "^\\s*(?:(?:private|protected|public)\\s+)?case\\s+class\\s+({IDENT}+)"},
+				{Type: "class", Pattern: "^\\s*(?:(?:private|protected|public)\\s+)?(?:final\\s+)?(?:sealed\\s+)?(?:abstract\\s+)?class\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:(?:private|protected|public)\\s+)?enum\\s+({IDENT}+)"},
+				{Type: "object", Pattern: "^\\s*(?:(?:private|protected|public)\\s+)?object\\s+({IDENT}+)"},
+				{Type: "trait", Pattern: "^\\s*(?:(?:private|protected|public)\\s+)?trait\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "(?:val|var|private|protected|public)\\s+(?:\\w+(?:<[^>]*>)?\\s+)+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?::\\s*[\\w\\[\\]<>?,=\\s]*)?(?:=|;)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "match", "case", "return", "yield", "def", "class", "trait", "object", "val", "var", "import", "package"},
+			ImportPattern:     "^\\s*import\\s+([\\w.]+)",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{"\"\"\""},
+			EscapeChar:        "\\",
+			SupportsNested:    true,
+			LangKey:           "scala",
+		},
+		"swift": {
+			Name:         "Swift",
+			Extensions:   []string{".swift"},
+			FuncPattern:  "^\\s*(?:public\\s+)?(?:static\\s+)?func\\s+({IDENT}+)\\s*\\(",
+			ClassPattern: "^\\s*(?:public\\s+)?(?:class|struct|enum|protocol)\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*(?:public\\s+)?(?:open\\s+)?(?:public\\s+)?(?:final\\s+)?class\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:public\\s+)?enum\\s+({IDENT}+)"},
+				{Type: "protocol", Pattern: "^\\s*(?:public\\s+)?protocol\\s+({IDENT}+)"},
+				{Type: "struct", Pattern: "^\\s*(?:public\\s+)?struct\\s+({IDENT}+)"},
+			},
+			FieldPattern:      "(?:var|let|public|private|internal|fileprivate|static)\\s+(?:\\w+(?:<[^>]*>)?\\s+)+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?::\\s*[\\w\\[\\]<>?,=\\s]*)?(?:\\{|=|;)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"func", "class", "struct", "enum", "protocol", "if", "else", "while", "for", "guard", "switch", "catch", "return", "throw", "import", "public", "private", "internal", "static", "var", "let"},
+			ImportPattern:     "^\\s*import\\s+(\\S+)",
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\""},
+			RawStringChars:    []string{"\"\"\".*?\"\"\""},
+			EscapeChar:        "\\",
+			SupportsNested:    true,
+			LangKey:           "swift",
+		},
+		"ts": {
+			Name:         "TypeScript",
+			Extensions:   []string{".ts", ".tsx"},
+			FuncPattern:  "^\\s*(?:(export\\s+)?(async\\s+)?function\\s*\\*?\\s+({IDENT}+)\\s*[<(]|(?:export\\s+)?(const|let|var)\\s+({IDENT}+)\\s*=\\s*(async\\s+)?[<(])",
+			ClassPattern: "^\\s*(?:export\\s+)?class\\s+({IDENT}+)",
+			StructTypePatterns: []StructTypePattern{
+				{Type: "class", Pattern: "^\\s*(?:export\\s+)?(?:abstract\\s+)?class\\s+({IDENT}+)"},
+				{Type: "enum", Pattern: "^\\s*(?:export\\s+)?(?:const\\s+)?enum\\s+({IDENT}+)"},
+				{Type: "interface", Pattern: "^\\s*(?:export\\s+)?interface\\s+({IDENT}+)"},
+				{Type: "type_alias", Pattern: "^\\s*(?:export\\s+)?type\\s+({IDENT}+)\\s*="},
+			},
+			FieldPattern:      "(?:(?:public|private|protected|readonly|static|abstract)\\s+)*(?:[a-zA-Z_][\\w\\[\\]]*)\\s+([a-zA-Z_][a-zA-Z0-9_]*)\\s*(?:\\?|=|;|,)",
+			CallPattern:       "({IDENT}+)\\s*\\(",
+			ExcludeWords:      []string{"if", "else", "while", "for", "switch", "case", "return", "typeof", "instanceof", "new", "delete", "void", "await", "async", "export", "import", "default"},
+			ImportPattern:     "^\\s*(?:import\\s+.*?from\\s+[\"']([^\"']+)[\"']|require\\s*\\(\\s*[\"']([^\"']+)[\"'])",
+			ExcludePatterns:   []string{"^\\.", "^\\./"},
+			LineComment:       "//",
+			BlockCommentStart: "/*",
+			BlockCommentEnd:   "*/",
+			StringChars:       []string{"\"", "'"},
+			RawStringChars:    []string{"`"},
+			EscapeChar:        "\\",
+			SupportsNested:    true,
+			LangKey:           "ts",
+		},
+	}
+}
@@ -0,0 +1,72 @@
+package internal
+
+import (
+	"encoding/json"
+	"testing"
+)
+
+// TestBuiltinConfigMatchesJSON pins the generated languages_gen.go to the
+// embedded languages.json: if the JSON is edited without re-running
+// `go generate ./internal`, this test fails.
+func TestBuiltinConfigMatchesJSON(t *testing.T) {
+	if builtinConfig == nil {
+		t.Fatal("builtinConfig is nil — languages_gen.go missing? run go generate ./internal")
+	}
+
+	jsonConfig, err := loadConfigFromJSON()
+	if err != nil {
+		t.Fatalf("loadConfigFromJSON() error = %v", err)
+	}
+
+	if len(builtinConfig) != len(jsonConfig) {
+		t.Fatalf("builtin has %d languages, JSON has %d", len(builtinConfig), len(jsonConfig))
+	}
+
+	for lang, jsonConf := range jsonConfig {
+		builtinConf, ok := builtinConfig[lang]
+		if !ok {
+			t.Errorf("language %q in JSON but not in generated config", lang)
+			continue
+		}
+
+		// Marshal both sides: JSON serialisation covers exactly the exported
+		// (configuration) fields and ignores the regex cache.
+		wantBytes, err := json.Marshal(jsonConf)
+		if err != nil {
+			t.Fatalf("%s: marshal JSON config: %v", lang, err)
+		}
+		gotBytes, err := json.Marshal(builtinConf)
+		if err != nil {
+			t.Fatalf("%s: marshal builtin config: %v", lang, err)
+		}
+		if string(gotBytes) != string(wantBytes) {
+			t.Errorf("%s: generated config differs from languages.json\n got: %s\nwant: %s", lang, gotBytes, wantBytes)
+		}
+	}
+}
+
+// TestBuiltinConfigCompiles forces the lazy compile for every language and
+// every pattern kind; generation validates patterns, this keeps it honest.
+func TestBuiltinConfigCompiles(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	for lang, lc := range config {
+		lc.FuncRegex()
+		lc.ClassRegex()
+		lc.GetStructPatterns()
+		lc.GetFieldPattern()
+		lc.CallRegex()
+		lc.DecoratorRegex()
+		lc.ImportRegex()
+		lc.BlockCommentRegex()
+		if lc.compileErr != nil {
+			t.Errorf("%s: pattern compilation failed: %v", lang, lc.compileErr)
+		}
+		if lc.FuncPattern != "" && lc.FuncRegex() == nil {
+			t.Errorf("%s: FuncRegex() is nil despite configured pattern", lang)
+		}
+	}
+}
@@ -0,0 +1,16 @@
+//go:build !unix
+
+package internal
+
+import "os"
+
+// mmapFile on platforms without a unix mmap syscall falls back to reading the
+// whole file; the zero-copy line splitting on top still avoids the per-line
+// allocations of bufio.Scanner.
+func mmapFile(path string) ([]byte, func(), error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, nil, err
+	}
+	return data, func() {}, nil
+}
@@ -0,0 +1,51 @@
+//go:build unix
+
+package internal
+
+import (
+	"os"
+	"syscall"
+)
+
+// mmapFile maps path read-only into memory and returns the file contents
+// together with a release function that must be called when the data is no
+// longer referenced. On mapping failure (e.g. special files) it falls back to
+// a plain read so callers never need a second code path.
+//
+// Note: as with any mmap, truncating the file concurrently can fault the
+// process. The scanners only map regular source files for the duration of a
+// single parse, which matches how the rest of the toolkit treats the tree as
+// read-only during a run.
+func mmapFile(path string) ([]byte, func(), error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, nil, err
+	}
+	defer f.Close()
+
+	info, err := f.Stat()
+	if err != nil {
+		return nil, nil, err
+	}
+	size := info.Size()
+	if size == 0 {
+		return nil, func() {}, nil
+	}
+	if size != int64(int(size)) {
+		// File too large for the address space; let the caller fail on read.
+		data, err := os.ReadFile(path)
+		return data, func() {}, err
+	}
+
+	data, err := syscall.Mmap(int(f.Fd()), 0, int(size), syscall.PROT_READ, syscall.MAP_PRIVATE)
+	if err != nil {
+		// Not mappable (pipe, proc file, ...) - fall back to a regular read
+		data, err := os.ReadFile(path)
+		return data, func() {}, err
+	}
+
+	release := func() {
+		syscall.Munmap(data) //nolint:errcheck
+	}
+	return data, release, nil
+}
@@ -0,0 +1,136 @@
+// parallel_sanitizer.go - Speculative chunk-parallel sanitization.
+//
+// Sanitizer state threads line to line, so CleanLines is strictly sequential
+// and one huge generated file uses exactly one core no matter what -workers
+// says. For files above a line threshold the lines are split into contiguous
+// chunks at likely-safe boundaries (preferring a cut right after an empty
+// line), every chunk is sanitized in parallel speculating a StateNormal entry,
+// and the seams are verified sequentially afterwards: a chunk whose real entry
+// state differs from the speculation — it actually starts inside a block
+// comment or multi-line string — is simply re-run from the correct state.
+// Mis-speculation requires a literal spanning the chosen boundary, so the
+// common case is a near-linear speedup plus one cheap verification pass.
+package internal
+
+import (
+	"runtime"
+	"strings"
+	"sync"
+)
+
+const (
+	// parallelSanitizeMinLines gates the parallel path: below this the
+	// goroutine and verification overhead outweighs the win, and dir-mode
+	// workers would oversubscribe the CPU on ordinary files. Only genuinely
+	// huge single files — where one file dominates the whole run — go
+	// parallel.
+	parallelSanitizeMinLines = 65536
+
+	// parallelSanitizeSnapWindow is how far past the even split point the
+	// splitter searches for an empty line to cut at.
+	parallelSanitizeSnapWindow = 200
+)
+
+// CleanLinesParallel is CleanLines with speculative chunk parallelism for
+// huge inputs. workers <= 0 means GOMAXPROCS; small inputs and workers == 1
+// fall through to the sequential path. Output is byte-identical to
+// CleanLines.
+func (s *Sanitizer) CleanLinesParallel(lines []string, workers int) []string {
+	if workers <= 0 {
+		workers = runtime.GOMAXPROCS(0)
+	}
+	if workers == 1 || len(lines) < parallelSanitizeMinLines {
+		return s.CleanLines(lines)
+	}
+	return s.cleanLinesChunked(lines, workers)
+}
+
+// cleanLinesChunked runs the speculative chunk pipeline unconditionally —
+// split out so tests can exercise it on small inputs.
+func (s *Sanitizer) cleanLinesChunked(lines []string, workers int) []string {
+	bounds := splitAtSafeBoundaries(lines, workers)
+
+	type chunkResult struct {
+		cleaned []string
+		exit    ParserState
+	}
+	results := make([]chunkResult, len(bounds)-1)
+
+	var wg sync.WaitGroup
+	for c := 0; c < len(results); c++ {
+		wg.Add(1)
+		go func(c int) {
+			defer wg.Done()
+			// Each worker owns a sanitizer: CleanLine reuses per-instance
+			// scratch buffers and is not safe for concurrent use.
+			ws := NewSanitizer(s.config, s.useRaw)
+			chunk := lines[bounds[c]:bounds[c+1]]
+			cleaned := make([]string, len(chunk))
+			state := StateNormal
+			for i, line := range chunk {
+				cleaned[i], state = ws.CleanLine(line, state)
+			}
+			results[c] = chunkResult{cleaned: cleaned, exit: state}
+		}(c)
+	}
+	wg.Wait()
+
+	// Verification pass: thread the real state through the seams. A chunk
+	// whose actual entry state matches the speculation (StateNormal) is
+	// accepted as-is; otherwise it is healed by re-running it sequentially
+	// from the state the previous chunk actually exited with.
+	out := make([]string, 0, len(lines))
+	state := StateNormal
+	var healer *Sanitizer
+	for c := 0; c < len(results); c++ {
+		if state == StateNormal {
+			out = append(out, results[c].cleaned...)
+			state = results[c].exit
+			continue
+		}
+		if healer == nil {
+			healer = NewSanitizer(s.config, s.useRaw)
+		}
+		for _, line := range lines[bounds[c]:bounds[c+1]] {
+			var cleanedLine string
+			cleanedLine, state = healer.CleanLine(line, state)
+			out = append(out, cleanedLine)
+		}
+	}
+	return out
+}
+
+// splitAtSafeBoundaries returns chunk boundaries [0, b1, ..., len(lines)]
+// for up to `chunks` contiguous chunks. Each cut prefers the line right after
+// the first empty line within the snap window past the even split point —
+// an empty line is the cheapest language-agnostic hint that no literal spans
+// the seam.
+func splitAtSafeBoundaries(lines []string, chunks int) []int {
+	if chunks < 1 {
+		chunks = 1
+	}
+	bounds := make([]int, 1, chunks+1)
+	target := len(lines) / chunks
+	if target < 1 {
+		target = 1
+	}
+	for c := 1; c < chunks; c++ {
+		idx := c * target
+		if idx <= bounds[len(bounds)-1] {
+			continue
+		}
+		snapped := idx
+		limit := idx + parallelSanitizeSnapWindow
+		for j := idx; j < limit && j < len(lines)-1; j++ {
+			if strings.TrimSpace(lines[j]) == "" {
+				snapped = j + 1
+				break
+			}
+		}
+		if snapped >= len(lines) {
+			break
+		}
+		bounds = append(bounds, snapped)
+	}
+	return append(bounds, len(lines))
+}
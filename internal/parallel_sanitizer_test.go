@@ -0,0 +1,164 @@
+package internal
+
+import (
+	"fmt"
+	"strings"
+	"testing"
+)
+
+// buildSanitizerInput генерирует исходник, в котором блочные комментарии и
+// многострочные строки пересекают любые равномерные границы чанков.
+func buildSanitizerInput(blocks int) []string {
+	var lines []string
+	for b := 0; b < blocks; b++ {
+		lines = append(lines,
+			fmt.Sprintf("func block%d() {", b),
+			fmt.Sprintf("\tx := \"literal %d with // fake comment\"", b),
+			"\t/* block comment",
+			"\t   spanning",
+			"\t   several lines */",
+			"\ty := `raw",
+			"\tstring {with braces}",
+			"\tover lines`",
+			"\tuse(x, y)",
+			"}",
+			"",
+		)
+	}
+	return lines
+}
+
+// TestCleanLinesChunked_MatchesSequential: чанк-параллельный проход обязан
+// давать побайтово тот же вывод, что и последовательный CleanLines, включая
+// случаи, когда спекуляция ошибается и чанк перепрогоняется.
+func TestCleanLinesChunked_MatchesSequential(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig(go) error = %v", err)
+	}
+
+	lines := buildSanitizerInput(40)
+
+	seq := NewSanitizer(langConfig, false).CleanLines(lines)
+	for _, workers := range []int{2, 3, 7, 16} {
+		par := NewSanitizer(langConfig, false).cleanLinesChunked(lines, workers)
+		if len(par) != len(seq) {
+			t.Fatalf("workers=%d: %d lines, want %d", workers, len(par), len(seq))
+		}
+		for i := range seq {
+			if par[i] != seq[i] {
+				t.Fatalf("workers=%d: line %d differs:\npar %q\nseq %q", workers, i+1, par[i], seq[i])
+			}
+		}
+	}
+}
+
+// TestCleanLinesChunked_HealsMisspeculation: один блочный комментарий на весь
+// файл гарантирует, что каждый чанк кроме первого стартует с неверным
+// спекулятивным состоянием и должен быть вылечен повторным прогоном.
+func TestCleanLinesChunked_HealsMisspeculation(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig(go) error = %v", err)
+	}
+
+	lines := []string{"/*"}
+	for i := 0; i < 100; i++ {
+		lines = append(lines, "func NotReallyCode() { looks(like, code) }")
+	}
+	lines = append(lines, "*/", "func Real() {", "\treal()", "}")
+
+	seq := NewSanitizer(langConfig, false).CleanLines(lines)
+	par := NewSanitizer(langConfig, false).cleanLinesChunked(lines, 8)
+	for i := range seq {
+		if par[i] != seq[i] {
+			t.Fatalf("line %d differs inside healed comment:\npar %q\nseq %q", i+1, par[i], seq[i])
+		}
+	}
+	// Строки внутри комментария должны быть вычищены
+	if strings.Contains(par[50], "NotReallyCode") {
+		t.Errorf("line inside block comment survived sanitization: %q", par[50])
+	}
+}
+
+// TestCleanLinesParallel_SmallInputFallsThrough: маленькие файлы идут по
+// последовательному пути и не платят за горутины.
+func TestCleanLinesParallel_SmallInputFallsThrough(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		t.Fatalf("GetLanguageConfig(go) error = %v", err)
+	}
+
+	lines := []string{"func A() { // comment", "\tb()", "}"}
+	s := NewSanitizer(langConfig, false)
+	got := s.CleanLinesParallel(lines, 8)
+	want := NewSanitizer(langConfig, false).CleanLines(lines)
+	for i := range want {
+		if got[i] != want[i] {
+			t.Errorf("line %d: %q, want %q", i+1, got[i], want[i])
+		}
+	}
+}
+
+// TestSplitAtSafeBoundaries: границы покрывают весь вход без пересечений и
+// предпочитают разрез сразу после пустой строки.
+func TestSplitAtSafeBoundaries(t *testing.T) {
+	lines := buildSanitizerInput(20) // 11 строк на блок, пустая — последняя
+	bounds := splitAtSafeBoundaries(lines, 4)
+
+	if bounds[0] != 0 || bounds[len(bounds)-1] != len(lines) {
+		t.Fatalf("bounds %v do not cover [0, %d]", bounds, len(lines))
+	}
+	for i := 1; i < len(bounds); i++ {
+		if bounds[i] <= bounds[i-1] {
+			t.Fatalf("bounds %v are not strictly increasing", bounds)
+		}
+	}
+	// Каждый внутренний разрез должен попасть на строку после пустой
+	for _, b := range bounds[1 : len(bounds)-1] {
+		if strings.TrimSpace(lines[b-1]) != "" {
+			t.Errorf("boundary %d is not right after an empty line (prev %q)", b, lines[b-1])
+		}
+	}
+}
+
+// BenchmarkCleanLinesChunked сравнивает чанк-параллельный проход с
+// последовательным на синтетическом большом файле.
+func BenchmarkCleanLinesChunked(b *testing.B) {
+	config, err := LoadConfig()
+	if err != nil {
+		b.Fatalf("LoadConfig() error = %v", err)
+	}
+	langConfig, err := config.GetLanguageConfig("go")
+	if err != nil {
+		b.Fatalf("GetLanguageConfig(go) error = %v", err)
+	}
+	lines := buildSanitizerInput(10000)
+
+	b.Run("sequential", func(b *testing.B) {
+		s := NewSanitizer(langConfig, false)
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			s.CleanLines(lines)
+		}
+	})
+	b.Run("chunked", func(b *testing.B) {
+		s := NewSanitizer(langConfig, false)
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			s.cleanLinesChunked(lines, 8)
+		}
+	})
+}
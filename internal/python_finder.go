@@ -12,9 +12,15 @@ type PythonFinder struct {
 	funcNames       map[string]bool
 	mode            string
 	extract         bool
+	firstMatch      bool
 	decoratorWindow *DecoratorWindow
 }
 
+// SetFirstMatch включает ранний выход при целевом поиске (см. Finder.SetFirstMatch).
+func (pf *PythonFinder) SetFirstMatch(v bool) {
+	pf.firstMatch = v
+}
+
 // NewPythonFinder создает новый парсер для Python
 func NewPythonFinder(config LanguageConfig, funcNames string, mode string, extract bool) *PythonFinder {
 	parsedNames := ParseFuncNames(funcNames)
@@ -50,10 +56,26 @@ func (pf *PythonFinder) FindFunctions(filename string) (*FindResult, error) {
 		return nil, fmt.Errorf("failed to compile function regex")
 	}
 
+	// Ранний выход: локальная копия имён, которые ещё не найдены
+	var pending map[string]bool
+	if pf.firstMatch && pf.mode != "map" && len(pf.funcNames) > 0 {
+		pending = make(map[string]bool, len(pf.funcNames))
+		for name := range pf.funcNames {
+			pending[name] = true
+		}
+	}
+
 	for i := 0; i < len(lines); i++ {
 		line := lines[i]
 		pf.decoratorWindow.Add(line, i+1)
 
+		// Быстрый байтовый префильтр: после отступа должно идти "def" или
+		// "async", иначе regex заведомо не совпадёт. Подавляющее
+		// большинство строк отсеивается здесь без запуска regex.
+		if !pythonLineMayStartFunc(line) {
+			continue
+		}
+
 		// Проверяем, начинается ли функция
 		matches := regex.FindStringSubmatch(line)
 		if matches == nil {
@@ -138,6 +160,15 @@ func (pf *PythonFinder) FindFunctions(filename string) (*FindResult, error) {
 
 		functions = append(functions, function)
 
+		// Ранний выход: все запрошенные имена найдены (границы функции уже
+		// вычислены выше, дочитывать файл незачем)
+		if pending != nil {
+			delete(pending, funcName)
+			if len(pending) == 0 {
+				break
+			}
+		}
+
 		// НЕ пропускаем строки если поддерживаем вложенные функции
 		// Это позволяет находить вложенные функции внутри внешних
 		if !pf.config.SupportsNested {
@@ -151,3 +182,33 @@ func (pf *PythonFinder) FindFunctions(filename string) (*FindResult, error) {
 		Filename:  filename,
 	}, nil
 }
+
+// pythonLineMayStartFunc — дешёвая байтовая проверка перед запуском
+// func-regex: строка может объявлять функцию только если после отступа идёт
+// "def" или "async" с пробельным символом следом (сам regex требует \s+).
+func pythonLineMayStartFunc(line string) bool {
+	i := 0
+	for i < len(line) && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r' || line[i] == '\f') {
+		i++
+	}
+	rest := line[i:]
+	switch {
+	case strings.HasPrefix(rest, "def"):
+		return pythonHasSpaceAt(rest, 3)
+	case strings.HasPrefix(rest, "async"):
+		return pythonHasSpaceAt(rest, 5)
+	}
+	return false
+}
+
+// pythonHasSpaceAt проверяет, что s[i] — пробельный байт из класса \s.
+func pythonHasSpaceAt(s string, i int) bool {
+	if i >= len(s) {
+		return false
+	}
+	switch s[i] {
+	case ' ', '\t', '\r', '\n', '\v', '\f':
+		return true
+	}
+	return false
+}
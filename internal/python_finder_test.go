@@ -505,3 +505,49 @@ func createTempFile(t *testing.T, content string, pattern string) string {
 
 	return tmpfile.Name()
 }
+
+func TestPythonLineMayStartFunc(t *testing.T) {
+	cases := []struct {
+		line string
+		want bool
+	}{
+		{"def foo():", true},
+		{"    def foo():", true},
+		{"\tasync def foo():", true},
+		{"async def foo():", true},
+		{"x = 1", false},
+		{"# def foo():", false},
+		{"", false},
+		{"   ", false},
+		{"defer()", false},       // "def" без пробела следом
+		{"asyncio.run()", false}, // "async" без пробела следом
+		{"class Foo:", false},
+		{"@decorator", false},
+	}
+	for _, c := range cases {
+		if got := pythonLineMayStartFunc(c.line); got != c.want {
+			t.Errorf("pythonLineMayStartFunc(%q) = %v, want %v", c.line, got, c.want)
+		}
+	}
+}
+
+func TestCountIndent(t *testing.T) {
+	cases := []struct {
+		line       string
+		wantIndent int
+		wantStart  int
+	}{
+		{"", 0, 0},
+		{"x", 0, 0},
+		{"    x", 4, 4},
+		{"\tx", 8, 1},
+		{"\t  x", 10, 3},
+		{"   ", 3, 3},
+	}
+	for _, c := range cases {
+		indent, start := countIndent(c.line)
+		if indent != c.wantIndent || start != c.wantStart {
+			t.Errorf("countIndent(%q) = (%d, %d), want (%d, %d)", c.line, indent, start, c.wantIndent, c.wantStart)
+		}
+	}
+}
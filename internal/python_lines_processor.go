@@ -49,29 +49,28 @@ func AnalyzePythonScopes(filePath string) ([]PythonScope, error) {
 		lineNum++
 		line := scanner.Text()
 
-		// Skip empty lines
-		trimmed := strings.TrimSpace(line)
-		if trimmed == "" {
-			continue
-		}
-
-		// Calculate indent level (tabs or spaces)
-		indent := countLeadingSpaces(line)
-		if indent == len(line) {
+		// Calculate indent level (tabs or spaces) and find the first
+		// payload byte in one byte-level pass
+		indent, start := countIndent(line)
+		if start == len(line) {
 			continue // empty or whitespace-only line
 		}
 
-		// Skip lines that are only comments
-		if len(trimmed) > 0 && trimmed[0] == '#' {
+		// Classify the line by its first byte: comments and decorators
+		// are decided without any further scanning
+		switch line[start] {
+		case '#':
 			continue
-		}
-
-		// Handle decorators: count them, they don't end scopes
-		if strings.HasPrefix(trimmed, "@") {
+		case '@':
 			pendingDecorators++
 			continue
 		}
 
+		trimmed := strings.TrimSpace(line[start:])
+		if trimmed == "" {
+			continue // юникодный пробел вне ASCII-отступа
+		}
+
 		// Detect function or class definition
 		// Note: "async def" functions also need to be detected
 		isDef := strings.HasPrefix(trimmed, "def ") || strings.HasPrefix(trimmed, "async def ")
@@ -322,16 +321,20 @@ func padToLen(s string, length int) string {
 	return strings.Repeat(" ", length-len(s))
 }
 
-func countLeadingSpaces(line string) int {
-	count := 0
-	for _, c := range line {
-		if c == ' ' {
-			count++
-		} else if c == '\t' {
-			count += 8 // tab is 8 spaces
-		} else {
-			break
+// countIndent измеряет отступ строки (таб = 8 пробелов) и возвращает вместе с
+// ним индекс первого не-пробельного байта, чтобы вызывающий код не сканировал
+// начало строки повторно.
+func countIndent(line string) (indent, start int) {
+	for start < len(line) {
+		switch line[start] {
+		case ' ':
+			indent++
+		case '\t':
+			indent += 8 // tab is 8 spaces
+		default:
+			return indent, start
 		}
+		start++
 	}
-	return count
+	return indent, start
 }
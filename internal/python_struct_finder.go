@@ -53,6 +53,19 @@ func (f *PythonStructFinder) FindStructures(filename string) (*StructFindResult,
 	return f.FindStructuresInLines(lines, 1, filename)
 }
 
+// FindStructuresScanned consumes a shared read+sanitize pass. The Python
+// finder does its own indent-aware processing over raw lines, so only the
+// I/O is shared; result strings are copied out because the scan's raw lines
+// become invalid at Release.
+func (f *PythonStructFinder) FindStructuresScanned(scan *FileScan) (*StructFindResult, error) {
+	result, err := f.FindStructuresInLines(scan.Lines, 1, scan.Path)
+	if err != nil {
+		return nil, err
+	}
+	detachStructResult(result)
+	return result, nil
+}
+
 // FindStructuresInLines finds types in pre-read lines
 func (f *PythonStructFinder) FindStructuresInLines(lines []string, startLine int, filename string) (*StructFindResult, error) {
 	lineOffset := startLine - 1
@@ -0,0 +1,159 @@
+// resultcache.go - Persistent per-file result cache for directory scans.
+//
+// DirProcessor re-parses every file on every run even though the per-file
+// checksum machinery (checksum_xxh3.go / checksum_stdlib.go) can already tell
+// that a file has not changed. The result cache persists the parsed DirResult
+// per path+checksum, so an incremental CI run where <1% of files changed only
+// re-parses those files.
+package internal
+
+import (
+	"encoding/json"
+	"os"
+	"sync"
+)
+
+// ResultCacheFile is the default on-disk location of the cache, relative to
+// the working directory (analogous to .codemap/ for split output).
+const ResultCacheFile = ".funcfinder-cache"
+
+// cachedSymbol is the serialized shape of one function or class. Lines are
+// never cached: dir mode does not extract bodies.
+type cachedSymbol struct {
+	Name      string `json:"name"`
+	Start     int    `json:"start"`
+	End       int    `json:"end"`
+	ClassName string `json:"class_name,omitempty"`
+}
+
+// resultCacheEntry holds the cached scan result for one file.
+type resultCacheEntry struct {
+	Checksum  string         `json:"checksum"`
+	WorkMode  string         `json:"work_mode"`
+	Functions []cachedSymbol `json:"functions,omitempty"`
+	Classes   []cachedSymbol `json:"classes,omitempty"`
+}
+
+// ResultCache maps file paths to their last parsed results. It is safe for
+// concurrent use by the worker pool.
+type ResultCache struct {
+	path string
+
+	mu      sync.Mutex
+	entries map[string]resultCacheEntry
+	dirty   bool
+}
+
+// LoadResultCache loads the cache from path. A missing or unreadable file
+// yields an empty cache — the cache is an optimization, never a hard error.
+func LoadResultCache(path string) *ResultCache {
+	c := &ResultCache{
+		path:    path,
+		entries: make(map[string]resultCacheEntry),
+	}
+
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return c
+	}
+	// A corrupt cache is silently dropped and rebuilt on Save.
+	json.Unmarshal(data, &c.entries) //nolint:errcheck
+	return c
+}
+
+// Lookup returns the cached result for filePath if its checksum and work mode
+// both match.
+func (c *ResultCache) Lookup(filePath, checksum, workMode string) (DirResult, bool) {
+	c.mu.Lock()
+	entry, ok := c.entries[filePath]
+	c.mu.Unlock()
+
+	if !ok || entry.Checksum != checksum || entry.WorkMode != workMode {
+		return DirResult{}, false
+	}
+
+	result := DirResult{Path: filePath}
+	for _, s := range entry.Functions {
+		result.Functions = append(result.Functions, FunctionBounds{
+			Name:      s.Name,
+			Start:     s.Start,
+			End:       s.End,
+			ClassName: s.ClassName,
+			Scope:     s.ClassName,
+		})
+	}
+	for _, s := range entry.Classes {
+		result.Classes = append(result.Classes, ClassBounds{
+			Name:  s.Name,
+			Start: s.Start,
+			End:   s.End,
+		})
+	}
+	return result, true
+}
+
+// Store records the scan result for filePath under the given checksum.
+// Results with errors are not cached.
+func (c *ResultCache) Store(filePath, checksum, workMode string, result DirResult) {
+	if result.Error != nil {
+		return
+	}
+
+	entry := resultCacheEntry{
+		Checksum: checksum,
+		WorkMode: workMode,
+	}
+	for _, fn := range result.Functions {
+		entry.Functions = append(entry.Functions, cachedSymbol{
+			Name:      fn.Name,
+			Start:     fn.Start,
+			End:       fn.End,
+			ClassName: fn.ClassName,
+		})
+	}
+	for _, cl := range result.Classes {
+		entry.Classes = append(entry.Classes, cachedSymbol{
+			Name:  cl.Name,
+			Start: cl.Start,
+			End:   cl.End,
+		})
+	}
+
+	c.mu.Lock()
+	c.entries[filePath] = entry
+	c.dirty = true
+	c.mu.Unlock()
+}
+
+// Save writes the cache back to disk if anything changed since loading.
+func (c *ResultCache) Save() error {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	if !c.dirty {
+		return nil
+	}
+	data, err := json.Marshal(c.entries)
+	if err != nil {
+		return err
+	}
+	if err := os.WriteFile(c.path, data, 0644); err != nil {
+		return err
+	}
+	c.dirty = false
+	return nil
+}
+
+// FileChecksum exposes the per-file checksum (XXH3 or the stdlib fallback,
+// see checksum_xxh3.go / checksum_stdlib.go) to callers outside the package,
+// e.g. cmd/astoracle's parse cache.
+func FileChecksum(path string) (string, error) {
+	return computeFileChecksum(path)
+}
+
+// Len returns the number of cached files.
+func (c *ResultCache) Len() int {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	return len(c.entries)
+}
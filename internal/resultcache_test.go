@@ -0,0 +1,115 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func TestResultCache_StoreLookup(t *testing.T) {
+	cache := LoadResultCache(filepath.Join(t.TempDir(), "cache.json"))
+
+	result := DirResult{
+		Path: "a.go",
+		Functions: []FunctionBounds{
+			{Name: "Foo", Start: 3, End: 5, ClassName: "Bar"},
+		},
+		Classes: []ClassBounds{
+			{Name: "Bar", Start: 1, End: 10},
+		},
+	}
+	cache.Store("a.go", "sum1", "all", result)
+
+	got, ok := cache.Lookup("a.go", "sum1", "all")
+	if !ok {
+		t.Fatal("expected cache hit for matching checksum and mode")
+	}
+	if len(got.Functions) != 1 || got.Functions[0].Name != "Foo" || got.Functions[0].ClassName != "Bar" {
+		t.Errorf("cached functions mismatch: %+v", got.Functions)
+	}
+	if len(got.Classes) != 1 || got.Classes[0].End != 10 {
+		t.Errorf("cached classes mismatch: %+v", got.Classes)
+	}
+
+	// Changed checksum or work mode must miss
+	if _, ok := cache.Lookup("a.go", "sum2", "all"); ok {
+		t.Error("expected miss for changed checksum")
+	}
+	if _, ok := cache.Lookup("a.go", "sum1", "functions"); ok {
+		t.Error("expected miss for different work mode")
+	}
+
+	// Errors are never cached
+	cache.Store("b.go", "sum1", "all", DirResult{Path: "b.go", Error: os.ErrNotExist})
+	if _, ok := cache.Lookup("b.go", "sum1", "all"); ok {
+		t.Error("results with errors must not be cached")
+	}
+}
+
+func TestResultCache_SaveLoadRoundTrip(t *testing.T) {
+	cachePath := filepath.Join(t.TempDir(), "cache.json")
+
+	cache := LoadResultCache(cachePath)
+	cache.Store("a.go", "sum1", "all", DirResult{
+		Path:      "a.go",
+		Functions: []FunctionBounds{{Name: "Foo", Start: 1, End: 2}},
+	})
+	if err := cache.Save(); err != nil {
+		t.Fatalf("Save() error = %v", err)
+	}
+
+	reloaded := LoadResultCache(cachePath)
+	if reloaded.Len() != 1 {
+		t.Fatalf("reloaded cache has %d entries, want 1", reloaded.Len())
+	}
+	got, ok := reloaded.Lookup("a.go", "sum1", "all")
+	if !ok || got.Functions[0].Name != "Foo" {
+		t.Errorf("reloaded lookup = %+v, %v; want Foo hit", got, ok)
+	}
+}
+
+func TestDirProcessor_WithResultCache(t *testing.T) {
+	tmpDir := t.TempDir()
+	goFile := filepath.Join(tmpDir, "main.go")
+	code := "package main\n\nfunc Hello() {\n\tprintln(\"hi\")\n}\n"
+	if err := os.WriteFile(goFile, []byte(code), 0644); err != nil {
+		t.Fatalf("Failed to create test file: %v", err)
+	}
+
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	cachePath := filepath.Join(tmpDir, ".funcfinder-cache")
+
+	// First run populates the cache
+	dp := NewDirProcessor(config, 1, true, false, "functions")
+	dp.SetResultCache(LoadResultCache(cachePath))
+	first, err := dp.ProcessDirectory(tmpDir)
+	if err != nil {
+		t.Fatalf("ProcessDirectory() error = %v", err)
+	}
+	if _, err := os.Stat(cachePath); err != nil {
+		t.Fatalf("cache file not written: %v", err)
+	}
+
+	// Second run is answered from cache and must return identical results
+	dp2 := NewDirProcessor(config, 1, true, false, "functions")
+	dp2.SetResultCache(LoadResultCache(cachePath))
+	second, err := dp2.ProcessDirectory(tmpDir)
+	if err != nil {
+		t.Fatalf("ProcessDirectory() (cached) error = %v", err)
+	}
+
+	if len(first) != 1 || len(second) != 1 {
+		t.Fatalf("expected 1 result from each run, got %d and %d", len(first), len(second))
+	}
+	if len(second[0].Functions) != 1 || second[0].Functions[0].Name != "Hello" {
+		t.Errorf("cached run functions = %+v, want Hello", second[0].Functions)
+	}
+	if second[0].Functions[0].Start != first[0].Functions[0].Start ||
+		second[0].Functions[0].End != first[0].Functions[0].End {
+		t.Errorf("cached bounds %+v differ from fresh bounds %+v", second[0].Functions[0], first[0].Functions[0])
+	}
+}
@@ -0,0 +1,62 @@
+// scanpipeline.go - Shared single-pass read+sanitize stage.
+//
+// Running --all plus the call-graph pass used to read and sanitize the same
+// file up to three times: Finder, StructFinder and BuildFileCallGraph each
+// did their own I/O and their own comment/string stripping. A FileScan does
+// both exactly once and hands the same sanitized line stream to every
+// analyzer via their *Scanned entry points.
+package internal
+
+import (
+	"fmt"
+	"strings"
+)
+
+// FileScan is one file read and sanitized once. Lines are zero-copy slices
+// into the mapped file and are only valid until Release; Cleaned lines are
+// fresh strings and may outlive it.
+type FileScan struct {
+	Path    string
+	Lines   []string // raw lines (zero-copy, valid until Release)
+	Cleaned []string // sanitized lines, same indexes as Lines
+	release func()
+}
+
+// ScanFile reads path once and sanitizes every line once with sanitizer.
+// The caller must Release the scan when the raw lines — and any substrings
+// of them — are no longer referenced.
+func ScanFile(path string, sanitizer *Sanitizer) (*FileScan, error) {
+	lines, release, err := readFileLinesZeroCopy(path)
+	if err != nil {
+		return nil, fmt.Errorf("failed to open file: %w", err)
+	}
+	return &FileScan{
+		Path:    path,
+		Lines:   lines,
+		Cleaned: sanitizer.CleanLinesParallel(lines, 0),
+		release: release,
+	}, nil
+}
+
+// Release unmaps the file backing Lines. Safe to call more than once.
+func (fs *FileScan) Release() {
+	if fs.release != nil {
+		fs.release()
+		fs.release = nil
+	}
+}
+
+// detachStructResult copies result strings that may be substrings of a scan's
+// raw lines, so the result stays valid after the scan is released.
+func detachStructResult(res *StructFindResult) {
+	for i := range res.Types {
+		t := &res.Types[i]
+		t.Name = strings.Clone(t.Name)
+		t.Kind = strings.Clone(t.Kind)
+		t.ParentType = strings.Clone(t.ParentType)
+		for j := range t.Fields {
+			t.Fields[j].Name = strings.Clone(t.Fields[j].Name)
+			t.Fields[j].Type = strings.Clone(t.Fields[j].Type)
+		}
+	}
+}
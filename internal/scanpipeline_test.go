@@ -0,0 +1,49 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+// TestScanFile_CleanedMatchesSanitizer checks that the shared scan produces
+// exactly the line stream each analyzer would have produced on its own.
+func TestScanFile_CleanedMatchesSanitizer(t *testing.T) {
+	config := newGoConfig()
+	code := "package p\n\n// comment with func noise\nfunc Real() {\n\ts := \"func fake() {\"\n\t_ = s\n}\n"
+
+	tmpfile := filepath.Join(t.TempDir(), "scan.go")
+	if err := os.WriteFile(tmpfile, []byte(code), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+
+	scan, err := ScanFile(tmpfile, NewSanitizer(config, false))
+	if err != nil {
+		t.Fatalf("ScanFile() error = %v", err)
+	}
+	defer scan.Release()
+
+	if len(scan.Cleaned) != len(scan.Lines) {
+		t.Fatalf("len(Cleaned) = %d, len(Lines) = %d", len(scan.Cleaned), len(scan.Lines))
+	}
+
+	want := NewSanitizer(config, false).CleanLines(scan.Lines)
+	for i := range want {
+		if scan.Cleaned[i] != want[i] {
+			t.Errorf("Cleaned[%d] = %q, want %q", i, scan.Cleaned[i], want[i])
+		}
+	}
+
+	// A finder fed the scan must see exactly what a standalone pass sees
+	finder := NewFinder(config, nil, true, false, false)
+	got, err := finder.FindFunctionsScanned(scan)
+	if err != nil {
+		t.Fatalf("FindFunctionsScanned() error = %v", err)
+	}
+	if len(got.Functions) != 1 || got.Functions[0].Name != "Real" {
+		t.Errorf("FindFunctionsScanned() = %+v, want just Real", got.Functions)
+	}
+
+	// Release must be safe to call twice
+	scan.Release()
+}
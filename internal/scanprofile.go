@@ -0,0 +1,159 @@
+// scanprofile.go - Per-stage timing for a directory scan.
+//
+// Answers "where does a slow scan spend its time" from inside one run instead
+// of attaching an external profiler: how long the walk took versus parsing,
+// how many files/bytes per second the workers sustained, and how evenly the
+// pool was utilized (one worker pinned at 100% while the rest idle means a
+// single huge file dominates the run). Counters are atomics updated from the
+// walk and worker goroutines; the report is computed once at the end.
+package internal
+
+import (
+	"sort"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// ScanProfile accumulates counters for one DirProcessor run. Attach it with
+// SetProfile before scanning and call Report afterwards. Safe for concurrent
+// updates; a nil *ScanProfile disables all accounting.
+type ScanProfile struct {
+	start     time.Time
+	walkNanos atomic.Int64
+
+	filesWalked    atomic.Int64
+	filesProcessed atomic.Int64
+	bytesProcessed atomic.Int64
+	symbolsFound   atomic.Int64
+	cacheHits      atomic.Int64
+	fileErrors     atomic.Int64
+
+	workerBusy []atomic.Int64 // busy nanoseconds per worker
+
+	// Optional per-file latency retention for percentiles (cmd/benchmark);
+	// off by default because it holds one duration per scanned file.
+	keepLatencies bool
+	latMu         sync.Mutex
+	latencies     []time.Duration
+}
+
+// NewScanProfile creates a profile for a pool of the given size and starts
+// the wall clock.
+func NewScanProfile(workers int) *ScanProfile {
+	return &ScanProfile{
+		start:      time.Now(),
+		workerBusy: make([]atomic.Int64, workers),
+	}
+}
+
+func (p *ScanProfile) noteWalked() {
+	if p != nil {
+		p.filesWalked.Add(1)
+	}
+}
+
+func (p *ScanProfile) noteWalkDone(d time.Duration) {
+	if p != nil {
+		p.walkNanos.Store(int64(d))
+	}
+}
+
+func (p *ScanProfile) noteCacheHit() {
+	if p != nil {
+		p.cacheHits.Add(1)
+	}
+}
+
+// noteProcessed records one finished job on the given worker.
+func (p *ScanProfile) noteProcessed(workerID int, job Job, result DirResult, busy time.Duration) {
+	if p == nil {
+		return
+	}
+	p.filesProcessed.Add(1)
+	p.bytesProcessed.Add(job.Size)
+	p.symbolsFound.Add(int64(len(result.Functions) + len(result.Classes)))
+	if result.Error != nil {
+		p.fileErrors.Add(1)
+	}
+	if workerID >= 0 && workerID < len(p.workerBusy) {
+		p.workerBusy[workerID].Add(int64(busy))
+	}
+	if p.keepLatencies {
+		p.latMu.Lock()
+		p.latencies = append(p.latencies, busy)
+		p.latMu.Unlock()
+	}
+}
+
+// EnableLatencies makes the profile retain every job's duration so Report can
+// compute p50/p99 per-file latency. Call before the scan starts.
+func (p *ScanProfile) EnableLatencies() {
+	p.keepLatencies = true
+}
+
+// ScanProfileReport is the machine-readable epilogue printed by --profile.
+type ScanProfileReport struct {
+	WallSeconds       float64   `json:"wall_seconds"`
+	WalkSeconds       float64   `json:"walk_seconds"`
+	FilesWalked       int64     `json:"files_walked"`
+	FilesProcessed    int64     `json:"files_processed"`
+	FilesPerSecond    float64   `json:"files_per_second"`
+	BytesProcessed    int64     `json:"bytes_processed"`
+	BytesPerSecond    float64   `json:"bytes_per_second"`
+	SymbolsFound      int64     `json:"symbols_found"`
+	CacheHits         int64     `json:"cache_hits"`
+	FileErrors        int64     `json:"file_errors"`
+	Workers           int       `json:"workers"`
+	WorkerBusySeconds []float64 `json:"worker_busy_seconds"`
+	WorkerUtilization []float64 `json:"worker_utilization"`
+
+	// Only set when EnableLatencies was called.
+	P50FileSeconds float64 `json:"p50_file_seconds,omitempty"`
+	P99FileSeconds float64 `json:"p99_file_seconds,omitempty"`
+}
+
+// Report stops the wall clock and computes rates. Utilization is busy time
+// over wall time per worker; a wide spread points at skewed job sizes.
+func (p *ScanProfile) Report() ScanProfileReport {
+	wall := time.Since(p.start)
+	r := ScanProfileReport{
+		WallSeconds:    wall.Seconds(),
+		WalkSeconds:    time.Duration(p.walkNanos.Load()).Seconds(),
+		FilesWalked:    p.filesWalked.Load(),
+		FilesProcessed: p.filesProcessed.Load(),
+		BytesProcessed: p.bytesProcessed.Load(),
+		SymbolsFound:   p.symbolsFound.Load(),
+		CacheHits:      p.cacheHits.Load(),
+		FileErrors:     p.fileErrors.Load(),
+		Workers:        len(p.workerBusy),
+	}
+	if secs := wall.Seconds(); secs > 0 {
+		r.FilesPerSecond = float64(r.FilesProcessed) / secs
+		r.BytesPerSecond = float64(r.BytesProcessed) / secs
+	}
+	for i := range p.workerBusy {
+		busy := time.Duration(p.workerBusy[i].Load()).Seconds()
+		r.WorkerBusySeconds = append(r.WorkerBusySeconds, busy)
+		util := 0.0
+		if wall.Seconds() > 0 {
+			util = busy / wall.Seconds()
+		}
+		r.WorkerUtilization = append(r.WorkerUtilization, util)
+	}
+
+	p.latMu.Lock()
+	if len(p.latencies) > 0 {
+		sorted := make([]time.Duration, len(p.latencies))
+		copy(sorted, p.latencies)
+		sort.Slice(sorted, func(i, j int) bool { return sorted[i] < sorted[j] })
+		r.P50FileSeconds = sorted[len(sorted)/2].Seconds()
+		p99 := len(sorted) * 99 / 100
+		if p99 >= len(sorted) {
+			p99 = len(sorted) - 1
+		}
+		r.P99FileSeconds = sorted[p99].Seconds()
+	}
+	p.latMu.Unlock()
+	return r
+}
@@ -0,0 +1,61 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func TestScanProfile_CountsDirectoryRun(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	dir := t.TempDir()
+	files := map[string]string{
+		"a.go": "package p\n\nfunc One() {\n}\n\nfunc Two() {\n}\n",
+		"b.go": "package p\n\nfunc Three() {\n}\n",
+	}
+	var totalBytes int64
+	for name, content := range files {
+		if err := os.WriteFile(filepath.Join(dir, name), []byte(content), 0644); err != nil {
+			t.Fatalf("WriteFile() error = %v", err)
+		}
+		totalBytes += int64(len(content))
+	}
+
+	dp := NewDirProcessor(config, 2, true, false, "functions")
+	profile := NewScanProfile(dp.Workers())
+	dp.SetProfile(profile)
+
+	if _, err := dp.ProcessDirectory(dir); err != nil {
+		t.Fatalf("ProcessDirectory() error = %v", err)
+	}
+
+	r := profile.Report()
+	if r.FilesWalked != 2 || r.FilesProcessed != 2 {
+		t.Errorf("walked/processed = %d/%d, want 2/2", r.FilesWalked, r.FilesProcessed)
+	}
+	if r.BytesProcessed != totalBytes {
+		t.Errorf("BytesProcessed = %d, want %d", r.BytesProcessed, totalBytes)
+	}
+	if r.SymbolsFound != 3 {
+		t.Errorf("SymbolsFound = %d, want 3", r.SymbolsFound)
+	}
+	if r.Workers != 2 || len(r.WorkerBusySeconds) != 2 || len(r.WorkerUtilization) != 2 {
+		t.Errorf("worker stats sized wrong: %+v", r)
+	}
+	if r.WallSeconds <= 0 || r.FilesPerSecond <= 0 {
+		t.Errorf("rates not computed: wall=%v files/s=%v", r.WallSeconds, r.FilesPerSecond)
+	}
+}
+
+// TestScanProfile_NilIsSafe: every hook must be callable through a nil
+// profile — that's how profiling stays free when --profile is off.
+func TestScanProfile_NilIsSafe(t *testing.T) {
+	var p *ScanProfile
+	p.noteWalked()
+	p.noteWalkDone(0)
+	p.noteCacheHit()
+	p.noteProcessed(0, Job{}, DirResult{}, 0)
+}
@@ -0,0 +1,216 @@
+// serve.go - Persistent query server with an in-memory directory index.
+//
+// Every normal invocation of funcfinder pays LoadConfig + regex compilation +
+// directory walk + full file scan, even when the same tree is queried hundreds
+// of times per minute. Serve mode keeps one warm process holding the parsed
+// Config and the last ProcessDirectory results, and answers map/func/struct
+// queries over a local unix socket in milliseconds.
+package internal
+
+import (
+	"encoding/json"
+	"fmt"
+	"net"
+	"os"
+	"sync"
+)
+
+// ServeRequest is one query sent by a client over the socket. Exactly one
+// JSON-encoded request is read per connection, answered, and the connection
+// is closed.
+type ServeRequest struct {
+	// Op is one of: "map" (all functions+types), "func" (lookup named
+	// functions), "struct" (all types), "rescan" (rebuild the index),
+	// "shutdown" (stop the server).
+	Op string `json:"op"`
+	// Names holds the function/type names for "func" and "struct" lookups.
+	Names []string `json:"names,omitempty"`
+}
+
+// ServeResponse is the answer to a single ServeRequest.
+type ServeResponse struct {
+	OK    bool       `json:"ok"`
+	Error string     `json:"error,omitempty"`
+	Files []jsonFile `json:"files,omitempty"`
+	// Stats for rescan/map responses
+	TotalFiles     int `json:"total_files,omitempty"`
+	TotalFunctions int `json:"total_functions,omitempty"`
+	TotalClasses   int `json:"total_classes,omitempty"`
+}
+
+// QueryServer holds the warm state: the parsed config (inside the processor)
+// and the most recent full-directory scan results.
+type QueryServer struct {
+	processor *DirProcessor
+	rootPath  string
+
+	mu      sync.RWMutex
+	results []DirResult
+}
+
+// NewQueryServer creates a server for rootPath. The processor should be in
+// "all" work mode so both func and struct queries can be answered from the
+// same index.
+func NewQueryServer(processor *DirProcessor, rootPath string) *QueryServer {
+	return &QueryServer{
+		processor: processor,
+		rootPath:  rootPath,
+	}
+}
+
+// Rescan rebuilds the in-memory index by re-running the full directory scan.
+func (qs *QueryServer) Rescan() error {
+	results, err := qs.processor.ProcessDirectory(qs.rootPath)
+	if err != nil {
+		return err
+	}
+	qs.mu.Lock()
+	qs.results = results
+	qs.mu.Unlock()
+	return nil
+}
+
+// Serve performs the initial scan and then answers queries on socketPath
+// until a "shutdown" request arrives. The socket file is removed on exit.
+func (qs *QueryServer) Serve(socketPath string) error {
+	if err := qs.Rescan(); err != nil {
+		return fmt.Errorf("initial scan: %w", err)
+	}
+
+	// Remove a stale socket from a previous run; Listen fails on EADDRINUSE.
+	os.Remove(socketPath)
+	listener, err := net.Listen("unix", socketPath)
+	if err != nil {
+		return fmt.Errorf("listening on %s: %w", socketPath, err)
+	}
+	defer listener.Close()
+	defer os.Remove(socketPath)
+
+	InfoMessage("Serving %s on %s (%d files indexed)", qs.rootPath, socketPath, qs.fileCount())
+
+	for {
+		conn, err := listener.Accept()
+		if err != nil {
+			// Listener closed (shutdown) or fatal accept error.
+			return nil
+		}
+		if shutdown := qs.handleConn(conn); shutdown {
+			return nil
+		}
+	}
+}
+
+func (qs *QueryServer) fileCount() int {
+	qs.mu.RLock()
+	defer qs.mu.RUnlock()
+	return len(qs.results)
+}
+
+// handleConn reads one request, writes one response and closes the
+// connection. It reports whether the request asked the server to shut down.
+func (qs *QueryServer) handleConn(conn net.Conn) (shutdown bool) {
+	defer conn.Close()
+
+	var req ServeRequest
+	if err := json.NewDecoder(conn).Decode(&req); err != nil {
+		json.NewEncoder(conn).Encode(ServeResponse{Error: fmt.Sprintf("decoding request: %v", err)}) //nolint:errcheck
+		return false
+	}
+
+	resp := qs.answer(&req)
+	json.NewEncoder(conn).Encode(resp) //nolint:errcheck
+	return req.Op == "shutdown" && resp.OK
+}
+
+// answer resolves a request against the in-memory index.
+func (qs *QueryServer) answer(req *ServeRequest) ServeResponse {
+	switch req.Op {
+	case "map":
+		return qs.queryMap(true, true, nil)
+
+	case "func":
+		if len(req.Names) == 0 {
+			return ServeResponse{Error: "func query requires names"}
+		}
+		return qs.queryMap(true, false, req.Names)
+
+	case "struct":
+		return qs.queryMap(false, true, req.Names)
+
+	case "rescan":
+		if err := qs.Rescan(); err != nil {
+			return ServeResponse{Error: err.Error()}
+		}
+		resp := qs.queryMap(true, true, nil)
+		resp.Files = nil // rescan returns stats only
+		return resp
+
+	case "shutdown":
+		return ServeResponse{OK: true}
+
+	default:
+		return ServeResponse{Error: fmt.Sprintf("unknown op: %q", req.Op)}
+	}
+}
+
+// queryMap builds the response from cached results. With names set, only
+// symbols whose name is in the set are included; an empty names slice means
+// "everything".
+func (qs *QueryServer) queryMap(wantFuncs, wantClasses bool, names []string) ServeResponse {
+	nameSet := make(map[string]bool, len(names))
+	for _, n := range names {
+		nameSet[n] = true
+	}
+	match := func(name string) bool {
+		return len(nameSet) == 0 || nameSet[name]
+	}
+
+	qs.mu.RLock()
+	defer qs.mu.RUnlock()
+
+	resp := ServeResponse{OK: true, Files: []jsonFile{}}
+	for _, r := range qs.results {
+		jf := jsonFile{Path: r.Path, Functions: []jsonSymbol{}, Classes: []jsonSymbol{}}
+		if wantFuncs {
+			for _, fn := range r.Functions {
+				if match(fn.Name) {
+					jf.Functions = append(jf.Functions, jsonSymbol{Name: fn.Name, Line: fn.Start})
+				}
+			}
+		}
+		if wantClasses {
+			for _, c := range r.Classes {
+				if match(c.Name) {
+					jf.Classes = append(jf.Classes, jsonSymbol{Name: c.Name, Line: c.Start})
+				}
+			}
+		}
+		if len(jf.Functions) == 0 && len(jf.Classes) == 0 {
+			continue
+		}
+		resp.Files = append(resp.Files, jf)
+		resp.TotalFiles++
+		resp.TotalFunctions += len(jf.Functions)
+		resp.TotalClasses += len(jf.Classes)
+	}
+	return resp
+}
+
+// QueryServe sends a single request to a running serve-mode instance and
+// returns its response. Used by the client side of --serve.
+func QueryServe(socketPath string, req *ServeRequest) (*ServeResponse, error) {
+	conn, err := net.Dial("unix", socketPath)
+	if err != nil {
+		return nil, fmt.Errorf("connecting to %s (is --serve running?): %w", socketPath, err)
+	}
+	defer conn.Close()
+
+	if err := json.NewEncoder(conn).Encode(req); err != nil {
+		return nil, fmt.Errorf("sending request: %w", err)
+	}
+	var resp ServeResponse
+	if err := json.NewDecoder(conn).Decode(&resp); err != nil {
+		return nil, fmt.Errorf("reading response: %w", err)
+	}
+	return &resp, nil
+}
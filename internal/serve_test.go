@@ -0,0 +1,131 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+)
+
+func writeServeFixture(t *testing.T) string {
+	t.Helper()
+	tmpDir := t.TempDir()
+
+	goFile := filepath.Join(tmpDir, "main.go")
+	code := `package main
+
+type Server struct {
+	port int
+}
+
+func Start() {
+	println("start")
+}
+
+func Stop() {
+	println("stop")
+}
+`
+	if err := os.WriteFile(goFile, []byte(code), 0644); err != nil {
+		t.Fatalf("Failed to create test file: %v", err)
+	}
+	return tmpDir
+}
+
+func newTestQueryServer(t *testing.T, root string) *QueryServer {
+	t.Helper()
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	dp := NewDirProcessor(config, 1, true, false, "all")
+	return NewQueryServer(dp, root)
+}
+
+func TestQueryServer_Answer(t *testing.T) {
+	root := writeServeFixture(t)
+	qs := newTestQueryServer(t, root)
+	if err := qs.Rescan(); err != nil {
+		t.Fatalf("Rescan() error = %v", err)
+	}
+
+	// map: everything
+	resp := qs.answer(&ServeRequest{Op: "map"})
+	if !resp.OK {
+		t.Fatalf("map query failed: %s", resp.Error)
+	}
+	if resp.TotalFunctions != 2 {
+		t.Errorf("map: expected 2 functions, got %d", resp.TotalFunctions)
+	}
+	if resp.TotalClasses == 0 {
+		t.Errorf("map: expected at least 1 class/type, got 0")
+	}
+
+	// func: only the named function
+	resp = qs.answer(&ServeRequest{Op: "func", Names: []string{"Start"}})
+	if !resp.OK {
+		t.Fatalf("func query failed: %s", resp.Error)
+	}
+	if resp.TotalFunctions != 1 {
+		t.Errorf("func Start: expected 1 function, got %d", resp.TotalFunctions)
+	}
+	if resp.TotalClasses != 0 {
+		t.Errorf("func Start: expected 0 classes, got %d", resp.TotalClasses)
+	}
+
+	// func without names is an error
+	resp = qs.answer(&ServeRequest{Op: "func"})
+	if resp.OK {
+		t.Error("func query without names should fail")
+	}
+
+	// unknown op is an error
+	resp = qs.answer(&ServeRequest{Op: "frobnicate"})
+	if resp.OK {
+		t.Error("unknown op should fail")
+	}
+}
+
+func TestQueryServer_SocketRoundTrip(t *testing.T) {
+	root := writeServeFixture(t)
+	qs := newTestQueryServer(t, root)
+
+	socketPath := filepath.Join(t.TempDir(), "ff.sock")
+	serveErr := make(chan error, 1)
+	go func() {
+		serveErr <- qs.Serve(socketPath)
+	}()
+
+	// Wait for the socket file to appear
+	for i := 0; i < 100; i++ {
+		if _, err := os.Stat(socketPath); err == nil {
+			break
+		}
+		time.Sleep(10 * time.Millisecond)
+	}
+
+	resp, err := QueryServe(socketPath, &ServeRequest{Op: "map"})
+	if err != nil {
+		t.Fatalf("QueryServe(map) error = %v", err)
+	}
+	if !resp.OK || resp.TotalFunctions != 2 {
+		t.Errorf("map over socket: ok=%v functions=%d, want ok=true functions=2", resp.OK, resp.TotalFunctions)
+	}
+
+	resp, err = QueryServe(socketPath, &ServeRequest{Op: "shutdown"})
+	if err != nil {
+		t.Fatalf("QueryServe(shutdown) error = %v", err)
+	}
+	if !resp.OK {
+		t.Errorf("shutdown failed: %s", resp.Error)
+	}
+
+	select {
+	case err := <-serveErr:
+		if err != nil {
+			t.Errorf("Serve() error = %v", err)
+		}
+	case <-time.After(2 * time.Second):
+		t.Error("server did not shut down after shutdown request")
+	}
+}
@@ -0,0 +1,110 @@
+// shardcompress.go - Optional gzip compression for split shard output.
+//
+// Shard JSON compresses roughly 10:1, which matters when the split output is
+// a CI artifact. With compression on, every shard file is written through a
+// streaming gzip writer and gets a ".gz" suffix; the manifest records the
+// real filename, so readers, the incremental path, and --merge-shards keep
+// working unchanged. OpenShardReader / ForEachShard are the consumer side:
+// they decode shard-by-shard through a streaming reader, so nothing is ever
+// inflated to disk. The codec is stdlib gzip — the shape of the API keeps a
+// future codec change local to this file.
+package internal
+
+import (
+	"compress/gzip"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+)
+
+// CompressedShardExt is appended to shard filenames written with compression.
+const CompressedShardExt = ".gz"
+
+// shardBaseName strips the compression suffix, giving the stable name used
+// to match shards across runs regardless of each run's compression setting.
+func shardBaseName(name string) string {
+	return strings.TrimSuffix(name, CompressedShardExt)
+}
+
+// writeShardContent writes one shard's JSON to path, streaming it through
+// gzip when compress is set. path must already carry the right extension.
+func writeShardContent(path, content string, compress bool) error {
+	if !compress {
+		return os.WriteFile(path, []byte(content), 0644)
+	}
+
+	f, err := os.OpenFile(path, os.O_WRONLY|os.O_CREATE|os.O_TRUNC, 0644)
+	if err != nil {
+		return err
+	}
+	zw := gzip.NewWriter(f)
+	if _, err := io.WriteString(zw, content); err != nil {
+		f.Close() //nolint:errcheck
+		return err
+	}
+	if err := zw.Close(); err != nil {
+		f.Close() //nolint:errcheck
+		return err
+	}
+	return f.Close()
+}
+
+// shardReadCloser closes both the decompressor and the underlying file.
+type shardReadCloser struct {
+	io.Reader
+	closers []io.Closer
+}
+
+func (rc *shardReadCloser) Close() error {
+	var firstErr error
+	for _, c := range rc.closers {
+		if err := c.Close(); err != nil && firstErr == nil {
+			firstErr = err
+		}
+	}
+	return firstErr
+}
+
+// OpenShardReader opens a shard file for streaming reads, transparently
+// decompressing ".gz" shards. The caller owns the returned ReadCloser.
+func OpenShardReader(path string) (io.ReadCloser, error) {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil, err
+	}
+	if !strings.HasSuffix(path, CompressedShardExt) {
+		return f, nil
+	}
+	zr, err := gzip.NewReader(f)
+	if err != nil {
+		f.Close() //nolint:errcheck
+		return nil, fmt.Errorf("opening compressed shard %s: %w", path, err)
+	}
+	return &shardReadCloser{Reader: zr, closers: []io.Closer{zr, f}}, nil
+}
+
+// ForEachShard walks a split output directory via its manifest and hands each
+// shard to fn as a streaming reader (decompressed if needed), one at a time.
+// fn must not retain the reader past its return.
+func ForEachShard(outDir string, fn func(info ShardInfo, r io.Reader) error) error {
+	manifest, err := loadManifest(outDir)
+	if err != nil {
+		return fmt.Errorf("reading manifest in %s: %w", outDir, err)
+	}
+	for _, shard := range manifest.Shards {
+		r, err := OpenShardReader(filepath.Join(outDir, shard.Path))
+		if err != nil {
+			return err
+		}
+		err = fn(shard, r)
+		if cerr := r.Close(); err == nil {
+			err = cerr
+		}
+		if err != nil {
+			return err
+		}
+	}
+	return nil
+}
@@ -0,0 +1,96 @@
+package internal
+
+import (
+	"encoding/json"
+	"io"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+)
+
+// TestWriteSplitOutput_Compressed: сжатые шарды должны читаться потоково
+// через ForEachShard и давать тот же JSON, что и несжатый вывод.
+func TestWriteSplitOutput_Compressed(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	root := t.TempDir()
+	files := map[string]string{
+		"a/one.go": "package a\n\nfunc One() {\n}\n",
+		"main.go":  "package m\n\nfunc Main() {\n}\n\nfunc Helper() {\n}\n",
+	}
+	for rel, content := range files {
+		path := filepath.Join(root, rel)
+		if err := os.MkdirAll(filepath.Dir(path), 0755); err != nil {
+			t.Fatalf("MkdirAll() error = %v", err)
+		}
+		if err := os.WriteFile(path, []byte(content), 0644); err != nil {
+			t.Fatalf("WriteFile() error = %v", err)
+		}
+	}
+
+	dp := NewDirProcessor(config, 2, true, false, "functions")
+	results, err := dp.ProcessDirectory(root)
+	if err != nil {
+		t.Fatalf("ProcessDirectory() error = %v", err)
+	}
+
+	plainDir := filepath.Join(t.TempDir(), "plain")
+	if _, err := WriteSplitOutput(results, plainDir, root, "dir"); err != nil {
+		t.Fatalf("WriteSplitOutput() error = %v", err)
+	}
+	gzDir := filepath.Join(t.TempDir(), "gz")
+	if _, err := WriteSplitOutput(results, gzDir, root, "dir", true); err != nil {
+		t.Fatalf("WriteSplitOutput(compress) error = %v", err)
+	}
+
+	plain := readShardJSON(t, plainDir)
+	compressed := readShardJSON(t, gzDir)
+	if len(compressed) != len(plain) || len(compressed) == 0 {
+		t.Fatalf("shard counts differ: plain %d, compressed %d", len(plain), len(compressed))
+	}
+	for base, want := range plain {
+		if got := compressed[base]; got != want {
+			t.Errorf("shard %s: compressed content differs from plain", base)
+		}
+	}
+
+	manifest, err := loadManifest(gzDir)
+	if err != nil {
+		t.Fatalf("loadManifest() error = %v", err)
+	}
+	for _, shard := range manifest.Shards {
+		if !strings.HasSuffix(shard.Path, CompressedShardExt) {
+			t.Errorf("manifest shard %s lacks %s suffix", shard.Path, CompressedShardExt)
+		}
+		if shard.Checksum == "" {
+			t.Errorf("shard %s has no checksum", shard.Path)
+		}
+	}
+}
+
+// readShardJSON проходит split-вывод через ForEachShard и возвращает
+// декодированный JSON каждого шарда по базовому имени.
+func readShardJSON(t *testing.T, outDir string) map[string]string {
+	t.Helper()
+	shards := make(map[string]string)
+	err := ForEachShard(outDir, func(info ShardInfo, r io.Reader) error {
+		data, err := io.ReadAll(r)
+		if err != nil {
+			return err
+		}
+		var decoded map[string]interface{}
+		if err := json.Unmarshal(data, &decoded); err != nil {
+			return err
+		}
+		shards[shardBaseName(info.Path)] = string(data)
+		return nil
+	})
+	if err != nil {
+		t.Fatalf("ForEachShard() error = %v", err)
+	}
+	return shards
+}
@@ -0,0 +1,107 @@
+// shardmerge.go - Merge step for multi-process sharded scans.
+//
+// With --shard i/N each process scans only the directories its ShardSlice
+// owns and writes an ordinary split output (shard JSON files + manifest +
+// symbol index) into its own directory. MergeShardOutputs combines those
+// partial outputs into one directory that is indistinguishable from a
+// single-process --split run: shard files are copied as-is (the partition
+// guarantees no two processes produce the same shard), manifests are summed
+// with their per-shard checksums preserved, and the binary symbol indexes
+// are re-merged into one sorted index.
+package internal
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+)
+
+// MergeShardOutputs combines the split outputs in partDirs into outDir and
+// returns a human-readable summary.
+func MergeShardOutputs(partDirs []string, outDir string) (string, error) {
+	if len(partDirs) == 0 {
+		return "", fmt.Errorf("no shard output directories given")
+	}
+	if err := os.MkdirAll(outDir, 0755); err != nil {
+		return "", fmt.Errorf("creating output directory: %w", err)
+	}
+
+	var merged Manifest
+	var allLocs []SymbolLocation
+	seen := make(map[string]string) // shard filename → part dir that produced it
+
+	for _, partDir := range partDirs {
+		m, err := loadManifest(partDir)
+		if err != nil {
+			return "", fmt.Errorf("reading manifest in %s: %w", partDir, err)
+		}
+
+		if merged.Version == "" {
+			merged.Version = m.Version
+			merged.RootDir = m.RootDir
+			merged.SplitBy = m.SplitBy
+		} else if m.SplitBy != merged.SplitBy {
+			return "", fmt.Errorf("%s was split by %q, earlier parts by %q", partDir, m.SplitBy, merged.SplitBy)
+		}
+
+		for _, shard := range m.Shards {
+			if prev, dup := seen[shard.Path]; dup {
+				return "", fmt.Errorf("shard %s produced by both %s and %s — parts overlap, check --shard specs", shard.Path, prev, partDir)
+			}
+			seen[shard.Path] = partDir
+
+			data, err := os.ReadFile(filepath.Join(partDir, shard.Path))
+			if err != nil {
+				return "", fmt.Errorf("reading shard %s from %s: %w", shard.Path, partDir, err)
+			}
+			if err := os.WriteFile(filepath.Join(outDir, shard.Path), data, 0644); err != nil {
+				return "", fmt.Errorf("writing shard %s: %w", shard.Path, err)
+			}
+
+			merged.Shards = append(merged.Shards, shard)
+			merged.TotalFiles += shard.Files
+			merged.TotalFunctions += shard.TotalFunctions
+			merged.TotalClasses += shard.TotalClasses
+		}
+
+		locs, err := readSymbolIndexRecords(filepath.Join(partDir, SymbolIndexName))
+		if err != nil {
+			return "", fmt.Errorf("reading symbol index in %s: %w", partDir, err)
+		}
+		allLocs = append(allLocs, locs...)
+	}
+
+	sort.Slice(merged.Shards, func(i, j int) bool { return merged.Shards[i].Path < merged.Shards[j].Path })
+
+	manifestPath := filepath.Join(outDir, "manifest.json")
+	if err := os.WriteFile(manifestPath, []byte(formatManifestJSON(&merged)), 0644); err != nil {
+		return "", fmt.Errorf("writing manifest: %w", err)
+	}
+
+	if err := WriteSymbolIndex(allLocs, outDir); err != nil {
+		return "", err
+	}
+
+	return fmt.Sprintf("Merged %d shard output(s) into %s/\n  Manifest: manifest.json\n  Index: %s\n  Shards: %d files\n  Total: %d files, %d functions, %d classes",
+		len(partDirs), outDir, SymbolIndexName, len(merged.Shards), merged.TotalFiles, merged.TotalFunctions, merged.TotalClasses), nil
+}
+
+// readSymbolIndexRecords loads every record from one part's symbols.idx. A
+// missing index is not an error — older outputs may predate it.
+func readSymbolIndexRecords(path string) ([]SymbolLocation, error) {
+	idx, err := OpenSymbolIndex(path)
+	if err != nil {
+		if os.IsNotExist(err) {
+			return nil, nil
+		}
+		return nil, err
+	}
+	defer idx.Close()
+
+	locs := make([]SymbolLocation, 0, idx.Len())
+	for i := 0; i < idx.Len(); i++ {
+		locs = append(locs, idx.Record(i))
+	}
+	return locs, nil
+}
@@ -0,0 +1,126 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func TestParseShardSlice(t *testing.T) {
+	if _, err := ParseShardSlice("4"); err == nil {
+		t.Error("ParseShardSlice(\"4\") should fail without index/total form")
+	}
+	if _, err := ParseShardSlice("4/4"); err == nil {
+		t.Error("ParseShardSlice(\"4/4\") should fail: index out of range")
+	}
+	if _, err := ParseShardSlice("-1/4"); err == nil {
+		t.Error("ParseShardSlice(\"-1/4\") should fail: negative index")
+	}
+	s, err := ParseShardSlice("2/4")
+	if err != nil {
+		t.Fatalf("ParseShardSlice(\"2/4\") error = %v", err)
+	}
+	if s.Index != 2 || s.Total != 4 {
+		t.Errorf("ParseShardSlice(\"2/4\") = %+v", s)
+	}
+}
+
+// TestShardSlice_Partition: каждая директория принадлежит ровно одному слайсу,
+// а нулевое значение владеет всем.
+func TestShardSlice_Partition(t *testing.T) {
+	keys := []string{"", "internal", "cmd/funcfinder", "cmd/stat", "pkg/a/b", "docs"}
+	const total = 3
+	for _, key := range keys {
+		owners := 0
+		for i := 0; i < total; i++ {
+			if (ShardSlice{Index: i, Total: total}).Owns(key) {
+				owners++
+			}
+		}
+		if owners != 1 {
+			t.Errorf("key %q owned by %d slices, want exactly 1", key, owners)
+		}
+	}
+	if !(ShardSlice{}).Owns("anything") {
+		t.Error("zero ShardSlice must own every key")
+	}
+}
+
+// TestMergeShardOutputs: два процесса со слайсами 0/2 и 1/2 вместе должны
+// дать тот же объединённый manifest, что и один полный прогон.
+func TestMergeShardOutputs(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+
+	root := t.TempDir()
+	files := map[string]string{
+		"a/one.go": "package a\n\nfunc One() {\n}\n",
+		"b/two.go": "package b\n\nfunc Two() {\n}\n\nfunc Three() {\n}\n",
+		"main.go":  "package m\n\nfunc Main() {\n}\n",
+	}
+	for rel, content := range files {
+		path := filepath.Join(root, rel)
+		if err := os.MkdirAll(filepath.Dir(path), 0755); err != nil {
+			t.Fatalf("MkdirAll() error = %v", err)
+		}
+		if err := os.WriteFile(path, []byte(content), 0644); err != nil {
+			t.Fatalf("WriteFile() error = %v", err)
+		}
+	}
+
+	var partDirs []string
+	totalResults := 0
+	for i := 0; i < 2; i++ {
+		dp := NewDirProcessor(config, 2, true, false, "functions")
+		dp.SetShardSlice(ShardSlice{Index: i, Total: 2})
+		results, err := dp.ProcessDirectory(root)
+		if err != nil {
+			t.Fatalf("ProcessDirectory() error = %v", err)
+		}
+		totalResults += len(results)
+
+		partDir := filepath.Join(t.TempDir(), "part")
+		if _, err := WriteSplitOutput(results, partDir, root, "dir"); err != nil {
+			t.Fatalf("WriteSplitOutput() error = %v", err)
+		}
+		partDirs = append(partDirs, partDir)
+	}
+	if totalResults != 3 {
+		t.Fatalf("slices together processed %d files, want 3", totalResults)
+	}
+
+	mergedDir := filepath.Join(t.TempDir(), "merged")
+	if _, err := MergeShardOutputs(partDirs, mergedDir); err != nil {
+		t.Fatalf("MergeShardOutputs() error = %v", err)
+	}
+
+	merged, err := loadManifest(mergedDir)
+	if err != nil {
+		t.Fatalf("loadManifest() error = %v", err)
+	}
+	if merged.TotalFiles != 3 || merged.TotalFunctions != 4 {
+		t.Errorf("merged manifest totals = %d files / %d functions, want 3/4", merged.TotalFiles, merged.TotalFunctions)
+	}
+	if len(merged.Shards) != 3 {
+		t.Errorf("merged manifest has %d shards, want 3 (a, b, root)", len(merged.Shards))
+	}
+	for _, shard := range merged.Shards {
+		if shard.Checksum == "" {
+			t.Errorf("shard %s lost its checksum in the merge", shard.Path)
+		}
+		if _, err := os.Stat(filepath.Join(mergedDir, shard.Path)); err != nil {
+			t.Errorf("shard file %s missing from merged output: %v", shard.Path, err)
+		}
+	}
+
+	idx, err := OpenSymbolIndex(filepath.Join(mergedDir, SymbolIndexName))
+	if err != nil {
+		t.Fatalf("OpenSymbolIndex() error = %v", err)
+	}
+	defer idx.Close()
+	if idx.Len() != 4 {
+		t.Errorf("merged symbol index has %d records, want 4", idx.Len())
+	}
+}
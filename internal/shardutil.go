@@ -1,7 +1,10 @@
 package internal
 
 import (
+	"fmt"
+	"hash/fnv"
 	"path/filepath"
+	"strconv"
 	"strings"
 )
 
@@ -22,6 +25,47 @@ func ShardKeyForPath(absPath, rootDir, splitBy string) string {
 	return key
 }
 
+// ShardSlice describes one process's share of a fanned-out scan: it owns the
+// shard keys whose FNV-1a hash falls on Index modulo Total. Every process
+// given the same Total partitions the tree identically, so N processes with
+// slices 0/N..N-1/N together cover every file exactly once. The zero value
+// (Total 0) owns everything.
+type ShardSlice struct {
+	Index int
+	Total int
+}
+
+// ParseShardSlice parses an "index/total" spec such as "0/4" (index is
+// zero-based, 0 <= index < total).
+func ParseShardSlice(spec string) (ShardSlice, error) {
+	idxStr, totalStr, ok := strings.Cut(spec, "/")
+	if !ok {
+		return ShardSlice{}, fmt.Errorf("shard spec %q: want index/total, e.g. 0/4", spec)
+	}
+	idx, err := strconv.Atoi(idxStr)
+	if err != nil {
+		return ShardSlice{}, fmt.Errorf("shard spec %q: bad index: %v", spec, err)
+	}
+	total, err := strconv.Atoi(totalStr)
+	if err != nil {
+		return ShardSlice{}, fmt.Errorf("shard spec %q: bad total: %v", spec, err)
+	}
+	if total < 1 || idx < 0 || idx >= total {
+		return ShardSlice{}, fmt.Errorf("shard spec %q: need 0 <= index < total", spec)
+	}
+	return ShardSlice{Index: idx, Total: total}, nil
+}
+
+// Owns reports whether this slice is responsible for the given shard key.
+func (s ShardSlice) Owns(key string) bool {
+	if s.Total <= 1 {
+		return true
+	}
+	h := fnv.New32a()
+	h.Write([]byte(key)) //nolint:errcheck
+	return int(h.Sum32()%uint32(s.Total)) == s.Index
+}
+
 // PathToShardName converts a shard key to a flat JSON filename.
 // e.g. "internal/auth" → "internal_auth.json", "" → "root.json"
 func PathToShardName(key string) string {
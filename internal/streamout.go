@@ -0,0 +1,147 @@
+// streamout.go - Streaming output writers for directory mode.
+//
+// AggregateDirResults renders everything from a fully materialized []DirResult,
+// which on monorepo scans means holding every file's symbols in memory before
+// a single byte is printed. The writers here emit each file's results as its
+// worker finishes and keep only running totals, so grep-style and JSON list
+// output become O(one file) in memory. Tree output still materializes — it
+// needs the whole hierarchy before it can draw anything.
+package internal
+
+import (
+	"bufio"
+	"encoding/json"
+	"io"
+	"strconv"
+)
+
+// DirResultWriter consumes directory-scan results one file at a time.
+// WriteResult must not be called after Close.
+type DirResultWriter interface {
+	WriteResult(r DirResult) error
+	// Close flushes buffered output and writes any trailer (JSON totals).
+	Close() error
+	// Totals reports files/functions/classes written so far.
+	Totals() (files, functions, classes int)
+}
+
+// NewDirResultWriter returns the streaming writer for the requested format:
+// JSON when jsonOut is set, grep-style otherwise.
+func NewDirResultWriter(w io.Writer, jsonOut bool) DirResultWriter {
+	if jsonOut {
+		return &jsonStreamWriter{w: bufio.NewWriter(w)}
+	}
+	return &grepStreamWriter{w: bufio.NewWriter(w)}
+}
+
+// grepStreamWriter emits "path:line: name" lines, matching
+// formatDirResultsGrep byte for byte.
+type grepStreamWriter struct {
+	w       *bufio.Writer
+	files   int
+	funcs   int
+	classes int
+}
+
+func (g *grepStreamWriter) WriteResult(r DirResult) error {
+	g.files++
+	for _, fn := range r.Functions {
+		g.w.WriteString(r.Path)                 //nolint:errcheck
+		g.w.WriteByte(':')                      //nolint:errcheck
+		g.w.WriteString(strconv.Itoa(fn.Start)) //nolint:errcheck
+		g.w.WriteString(": ")                   //nolint:errcheck
+		g.w.WriteString(fn.Name)                //nolint:errcheck
+		g.w.WriteByte('\n')                     //nolint:errcheck
+	}
+	for _, cl := range r.Classes {
+		g.w.WriteString(r.Path)                 //nolint:errcheck
+		g.w.WriteByte(':')                      //nolint:errcheck
+		g.w.WriteString(strconv.Itoa(cl.Start)) //nolint:errcheck
+		g.w.WriteString(": ")                   //nolint:errcheck
+		g.w.WriteString(cl.Name)                //nolint:errcheck
+		g.w.WriteByte('\n')                     //nolint:errcheck
+	}
+	g.funcs += len(r.Functions)
+	g.classes += len(r.Classes)
+	return g.w.Flush()
+}
+
+func (g *grepStreamWriter) Close() error {
+	return g.w.Flush()
+}
+
+func (g *grepStreamWriter) Totals() (int, int, int) {
+	return g.files, g.funcs, g.classes
+}
+
+// jsonStreamWriter produces the same document shape as formatDirResultsJSON
+// ({"files": [...], "total_*": N}) but writes each file entry as it arrives
+// instead of marshalling one giant value at the end.
+type jsonStreamWriter struct {
+	w       *bufio.Writer
+	started bool
+	wrote   bool
+	files   int
+	funcs   int
+	classes int
+}
+
+func (j *jsonStreamWriter) WriteResult(r DirResult) error {
+	// Same filter as the aggregate formatter: silent files are omitted
+	if len(r.Functions) == 0 && len(r.Classes) == 0 {
+		return nil
+	}
+
+	if !j.started {
+		j.w.WriteString("{\n  \"files\": [") //nolint:errcheck
+		j.started = true
+	}
+	if j.wrote {
+		j.w.WriteByte(',') //nolint:errcheck
+	}
+	j.w.WriteString("\n    ") //nolint:errcheck
+
+	jf := jsonFile{
+		Path:      r.Path,
+		Functions: make([]jsonSymbol, 0, len(r.Functions)),
+		Classes:   make([]jsonSymbol, 0, len(r.Classes)),
+	}
+	for _, fn := range r.Functions {
+		jf.Functions = append(jf.Functions, jsonSymbol{Name: fn.Name, Line: fn.Start})
+	}
+	for _, c := range r.Classes {
+		jf.Classes = append(jf.Classes, jsonSymbol{Name: c.Name, Line: c.Start})
+	}
+
+	// Indent to match json.MarshalIndent(..., "", "  ") of the whole document
+	b, err := json.MarshalIndent(jf, "    ", "  ")
+	if err != nil {
+		return err
+	}
+	j.w.Write(b) //nolint:errcheck
+
+	j.wrote = true
+	j.files++
+	j.funcs += len(r.Functions)
+	j.classes += len(r.Classes)
+	return j.w.Flush()
+}
+
+func (j *jsonStreamWriter) Close() error {
+	if !j.started {
+		j.w.WriteString("{\n  \"files\": [") //nolint:errcheck
+	}
+	if j.wrote {
+		j.w.WriteString("\n  ],\n") //nolint:errcheck
+	} else {
+		j.w.WriteString("],\n") //nolint:errcheck
+	}
+	j.w.WriteString("  \"total_files\": " + strconv.Itoa(j.files) + ",\n")       //nolint:errcheck
+	j.w.WriteString("  \"total_functions\": " + strconv.Itoa(j.funcs) + ",\n")   //nolint:errcheck
+	j.w.WriteString("  \"total_classes\": " + strconv.Itoa(j.classes) + "\n}\n") //nolint:errcheck
+	return j.w.Flush()
+}
+
+func (j *jsonStreamWriter) Totals() (int, int, int) {
+	return j.files, j.funcs, j.classes
+}
@@ -0,0 +1,93 @@
+package internal
+
+import (
+	"bytes"
+	"strings"
+	"testing"
+)
+
+func streamTestResults() []DirResult {
+	return []DirResult{
+		{
+			Path: "a/one.go",
+			Functions: []FunctionBounds{
+				{Name: "Alpha", Start: 3, End: 7},
+				{Name: "Beta", Start: 10, End: 20},
+			},
+		},
+		{
+			Path: "b/two.go", // silent file: omitted from JSON output
+		},
+		{
+			Path:    "c/three.go",
+			Classes: []ClassBounds{{Name: "Gamma", Start: 1, End: 40}},
+		},
+	}
+}
+
+// TestJSONStreamWriter_MatchesAggregate pins the streaming JSON encoder to
+// the document formatDirResultsJSON produces for the same results.
+func TestJSONStreamWriter_MatchesAggregate(t *testing.T) {
+	results := streamTestResults()
+
+	var buf bytes.Buffer
+	w := NewDirResultWriter(&buf, true)
+	for _, r := range results {
+		if err := w.WriteResult(r); err != nil {
+			t.Fatalf("WriteResult() error = %v", err)
+		}
+	}
+	if err := w.Close(); err != nil {
+		t.Fatalf("Close() error = %v", err)
+	}
+
+	want := formatDirResultsJSON(results)
+	if got := buf.String(); strings.TrimSpace(got) != strings.TrimSpace(want) {
+		t.Errorf("streaming JSON differs from aggregate:\n got: %s\nwant: %s", got, want)
+	}
+
+	files, funcs, classes := w.Totals()
+	if files != 2 || funcs != 2 || classes != 1 {
+		t.Errorf("Totals() = (%d, %d, %d), want (2, 2, 1)", files, funcs, classes)
+	}
+}
+
+func TestJSONStreamWriter_Empty(t *testing.T) {
+	var buf bytes.Buffer
+	w := NewDirResultWriter(&buf, true)
+	if err := w.Close(); err != nil {
+		t.Fatalf("Close() error = %v", err)
+	}
+	want := formatDirResultsJSON(nil)
+	if got := buf.String(); strings.TrimSpace(got) != strings.TrimSpace(want) {
+		t.Errorf("empty streaming JSON differs from aggregate:\n got: %q\nwant: %q", got, want)
+	}
+}
+
+// TestGrepStreamWriter_MatchesAggregate pins grep-style streaming output to
+// formatDirResultsGrep.
+func TestGrepStreamWriter_MatchesAggregate(t *testing.T) {
+	results := streamTestResults()
+
+	var buf bytes.Buffer
+	w := NewDirResultWriter(&buf, false)
+	for _, r := range results {
+		if err := w.WriteResult(r); err != nil {
+			t.Fatalf("WriteResult() error = %v", err)
+		}
+	}
+	if err := w.Close(); err != nil {
+		t.Fatalf("Close() error = %v", err)
+	}
+
+	if got, want := buf.String(), formatDirResultsGrep(results); got != want {
+		t.Errorf("streaming grep output differs:\n got: %q\nwant: %q", got, want)
+	}
+
+	// Grep totals count every processed file, matching the old
+	// "Processed N files" statistic
+	files, funcs, classes := w.Totals()
+	if files != 3 || funcs != 2 || classes != 1 {
+		t.Errorf("Totals() = (%d, %d, %d), want (3, 2, 1)", files, funcs, classes)
+	}
+}
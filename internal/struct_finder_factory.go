@@ -2,13 +2,6 @@
 // Supports multiple finder types: brace-based, indent-based, and hybrid languages
 package internal
 
-import (
-	"bufio"
-	"fmt"
-	"os"
-	"strings"
-)
-
 // StructFinderFactory creates appropriate struct finder based on language
 type StructFinderFactory struct{}
 
@@ -85,6 +78,9 @@ func (f *StructFinderFactory) determineFinderType(config *LanguageConfig) Finder
 type StructFinderInterface interface {
 	FindStructures(filename string) (*StructFindResult, error)
 	FindStructuresInLines(lines []string, startLine int, filename string) (*StructFindResult, error)
+	// FindStructuresScanned consumes a shared read+sanitize pass instead of
+	// doing its own I/O (see scanpipeline.go).
+	FindStructuresScanned(scan *FileScan) (*StructFindResult, error)
 }
 
 // HybridStructFinder handles languages with mixed syntax (JS/TS)
@@ -114,26 +110,27 @@ func NewHybridStructFinder(config *LanguageConfig, typeNamesStr string, mapMode,
 
 // FindStructures finds all types in the file
 func (f *HybridStructFinder) FindStructures(filename string) (*StructFindResult, error) {
-	file, err := os.Open(filename)
+	scan, err := ScanFile(filename, f.sanitizer)
 	if err != nil {
-		return nil, fmt.Errorf("failed to open file: %w", err)
-	}
-	defer file.Close()
-
-	var lines []string
-	scanner := bufio.NewScanner(file)
-	for scanner.Scan() {
-		lines = append(lines, scanner.Text())
-	}
-	if err := scanner.Err(); err != nil {
-		return nil, fmt.Errorf("failed to read file: %w", err)
+		return nil, err
 	}
-
-	return f.FindStructuresInLines(lines, 1, filename)
+	defer scan.Release()
+	return f.FindStructuresScanned(scan)
 }
 
 // FindStructuresInLines finds types in pre-read lines
 func (f *HybridStructFinder) FindStructuresInLines(lines []string, startLine int, filename string) (*StructFindResult, error) {
+	// One sanitize pass shared by the type and field scans
+	cleaned := f.sanitizer.CleanLinesParallel(lines, 0)
+	return f.findStructuresInCleaned(lines, cleaned, startLine, filename)
+}
+
+// FindStructuresScanned finds types over an already read and sanitized scan.
+func (f *HybridStructFinder) FindStructuresScanned(scan *FileScan) (*StructFindResult, error) {
+	return f.findStructuresInCleaned(scan.Lines, scan.Cleaned, 1, scan.Path)
+}
+
+func (f *HybridStructFinder) findStructuresInCleaned(lines, cleaned []string, startLine int, filename string) (*StructFindResult, error) {
 	lineOffset := startLine - 1
 
 	result := &StructFindResult{
@@ -142,12 +139,13 @@ func (f *HybridStructFinder) FindStructuresInLines(lines []string, startLine int
 	}
 
 	// Find all types
-	types := f.findAllTypes(lines, lineOffset)
+	types := f.findAllTypes(lines, cleaned, lineOffset)
 
-	// For each type, find its fields
+	// For each type, find its fields (one shared matcher for the whole file)
+	fieldScan := newFieldScanner(f.config)
 	for i := range types {
 		typeBounds := &types[i]
-		fields := f.findFieldsForType(lines, typeBounds, lineOffset)
+		fields := f.findFieldsForType(fieldScan, lines, cleaned, typeBounds, lineOffset)
 		typeBounds.Fields = fields
 		result.Types = append(result.Types, *typeBounds)
 	}
@@ -156,8 +154,7 @@ func (f *HybridStructFinder) FindStructuresInLines(lines []string, startLine int
 }
 
 // findAllTypes finds all type definitions in hybrid languages
-func (f *HybridStructFinder) findAllTypes(lines []string, lineOffset int) []TypeBounds {
-	state := StateNormal
+func (f *HybridStructFinder) findAllTypes(lines, cleanedLines []string, lineOffset int) []TypeBounds {
 	var types []TypeBounds
 	var currentType *TypeBounds
 	depth := 0
@@ -165,8 +162,7 @@ func (f *HybridStructFinder) findAllTypes(lines []string, lineOffset int) []Type
 	structPatterns := f.config.GetStructPatterns()
 
 	for lineNum, line := range lines {
-		cleaned, newState := f.sanitizer.CleanLine(line, state)
-		state = newState
+		cleaned := cleanedLines[lineNum]
 
 		if currentType != nil {
 			prevDepth := depth
@@ -240,20 +236,15 @@ func (f *HybridStructFinder) findAllTypes(lines []string, lineOffset int) []Type
 }
 
 // findFieldsForType finds all fields/members in a type definition
-func (f *HybridStructFinder) findFieldsForType(lines []string, typeBounds *TypeBounds, lineOffset int) []FieldBounds {
+func (f *HybridStructFinder) findFieldsForType(fieldScan *fieldScanner, lines, cleanedLines []string, typeBounds *TypeBounds, lineOffset int) []FieldBounds {
 	var fields []FieldBounds
-
-	fieldRegex := f.config.GetFieldPattern()
-	if fieldRegex == nil {
+	if fieldScan == nil {
 		return fields
 	}
 
-	state := StateNormal
-
 	for lineNum := typeBounds.Start - 1 - lineOffset; lineNum < len(lines) && lineNum < typeBounds.End-1-lineOffset; lineNum++ {
 		line := lines[lineNum]
-		cleaned, newState := f.sanitizer.CleanLine(line, state)
-		state = newState
+		cleaned := cleanedLines[lineNum]
 
 		if IsEmptyOrComment(cleaned, f.config.LineComment) {
 			continue
@@ -266,21 +257,12 @@ func (f *HybridStructFinder) findFieldsForType(lines []string, typeBounds *TypeB
 			}
 		}
 
-		matches := fieldRegex.FindStringSubmatch(cleaned)
-		if matches != nil && len(matches) >= 2 {
-			fieldName := matches[1]
-			fieldType := ""
-			if len(matches) >= 3 {
-				fieldType = strings.TrimSpace(matches[2])
-			}
-
-			if fieldName != "" && !isLikelyMethod(fieldName, cleaned) && !isExcludedWord(fieldName, f.config.ExcludeWords) {
-				fields = append(fields, FieldBounds{
-					Name: fieldName,
-					Type: fieldType,
-					Line: lineNum + 1 + lineOffset,
-				})
-			}
+		// Cheap shape gate first, regex only on survivors
+		if !fieldScan.lineMayBeField(cleaned) {
+			continue
+		}
+		if fb, ok := fieldScan.matchField(cleaned, lineNum+1+lineOffset); ok {
+			fields = append(fields, fb)
 		}
 	}
 
@@ -3,9 +3,7 @@
 package internal
 
 import (
-	"bufio"
-	"fmt"
-	"os"
+	"regexp"
 	"strings"
 )
 
@@ -57,28 +55,43 @@ func NewStructFinder(config *LanguageConfig, typeNamesStr string, mapMode bool)
 	}
 }
 
+// Reset retargets the finder to another language, keeping the sanitizer's
+// scratch buffers so directory-mode workers can reuse one StructFinder for
+// their whole job stream. Search settings (type names, mapMode) are kept.
+func (f *StructFinder) Reset(config *LanguageConfig) {
+	if f.config == config {
+		return
+	}
+	f.config = config
+	f.sanitizer.Reset(config, false)
+}
+
 // FindStructures finds all types in the file
 func (f *StructFinder) FindStructures(filename string) (*StructFindResult, error) {
-	file, err := os.Open(filename)
+	scan, err := ScanFile(filename, f.sanitizer)
 	if err != nil {
-		return nil, fmt.Errorf("failed to open file: %w", err)
-	}
-	defer file.Close()
-
-	var lines []string
-	scanner := bufio.NewScanner(file)
-	for scanner.Scan() {
-		lines = append(lines, scanner.Text())
-	}
-	if err := scanner.Err(); err != nil {
-		return nil, fmt.Errorf("failed to read file: %w", err)
+		return nil, err
 	}
-
-	return f.FindStructuresInLines(lines, 1, filename)
+	defer scan.Release()
+	return f.FindStructuresScanned(scan)
 }
 
 // FindStructuresInLines finds types in pre-read lines
 func (f *StructFinder) FindStructuresInLines(lines []string, startLine int, filename string) (*StructFindResult, error) {
+	// One sanitize pass shared by the type and field scans
+	cleaned := f.sanitizer.CleanLinesParallel(lines, 0)
+	return f.findStructuresInCleaned(lines, cleaned, startLine, filename)
+}
+
+// FindStructuresScanned finds types over an already read and sanitized scan,
+// skipping this finder's own I/O and sanitize pass.
+func (f *StructFinder) FindStructuresScanned(scan *FileScan) (*StructFindResult, error) {
+	return f.findStructuresInCleaned(scan.Lines, scan.Cleaned, 1, scan.Path)
+}
+
+// findStructuresInCleaned is the shared implementation: cleaned[i] is the
+// sanitized form of lines[i].
+func (f *StructFinder) findStructuresInCleaned(lines, cleaned []string, startLine int, filename string) (*StructFindResult, error) {
 	lineOffset := startLine - 1
 
 	result := &StructFindResult{
@@ -87,12 +100,13 @@ func (f *StructFinder) FindStructuresInLines(lines []string, startLine int, file
 	}
 
 	// Find all types using new struct patterns
-	types := f.findAllTypes(lines, lineOffset)
+	types := f.findAllTypes(lines, cleaned, lineOffset)
 
-	// For each type, find its fields
+	// For each type, find its fields (one shared matcher for the whole file)
+	fieldScan := newFieldScanner(f.config)
 	for i := range types {
 		typeBounds := &types[i]
-		fields := f.findFieldsForType(lines, typeBounds, lineOffset)
+		fields := f.findFieldsForType(fieldScan, lines, cleaned, typeBounds, lineOffset)
 		typeBounds.Fields = fields
 		result.Types = append(result.Types, *typeBounds)
 	}
@@ -101,8 +115,7 @@ func (f *StructFinder) FindStructuresInLines(lines []string, startLine int, file
 }
 
 // findAllTypes finds all type definitions in the file
-func (f *StructFinder) findAllTypes(lines []string, lineOffset int) []TypeBounds {
-	state := StateNormal
+func (f *StructFinder) findAllTypes(lines, cleanedLines []string, lineOffset int) []TypeBounds {
 	var types []TypeBounds
 	var currentType *TypeBounds
 	depth := 0
@@ -112,9 +125,7 @@ func (f *StructFinder) findAllTypes(lines []string, lineOffset int) []TypeBounds
 	hasStructPatterns := len(structPatterns) > 0
 
 	for lineNum, line := range lines {
-		// Clean line from comments and literals
-		cleaned, newState := f.sanitizer.CleanLine(line, state)
-		state = newState
+		cleaned := cleanedLines[lineNum]
 
 		if currentType != nil {
 			// We're inside a type definition - find end based on language type
@@ -323,25 +334,84 @@ func determineTypeKind(pattern string) string {
 	return "type"
 }
 
-// findFieldsForType finds all fields/members in a type definition
-func (f *StructFinder) findFieldsForType(lines []string, typeBounds *TypeBounds, lineOffset int) []FieldBounds {
-	var fields []FieldBounds
+// fieldScanner is the per-file field matcher shared by every type in a file:
+// the compiled regex, its mandatory literal and the exclude-word set are
+// fetched and built once instead of per type body.
+type fieldScanner struct {
+	regex   *regexp.Regexp
+	literal string
+	exclude map[string]bool
+}
 
-	// Get the field pattern from config
-	fieldRegex := f.config.GetFieldPattern()
+// newFieldScanner returns nil when the language has no field pattern.
+func newFieldScanner(config *LanguageConfig) *fieldScanner {
+	re := config.GetFieldPattern()
+	if re == nil {
+		return nil
+	}
+	fs := &fieldScanner{regex: re, literal: config.FieldLiteral()}
+	if len(config.ExcludeWords) > 0 {
+		fs.exclude = make(map[string]bool, len(config.ExcludeWords))
+		for _, w := range config.ExcludeWords {
+			fs.exclude[w] = true
+		}
+	}
+	return fs
+}
 
-	if fieldRegex == nil {
-		return fields // No pattern configured
+// lineMayBeField is the cheap byte-level shape gate run before the regex.
+// A line containing parentheses can never yield a field (the old
+// isLikelyMethod check rejected such matches after the fact), a field line
+// must contain at least one identifier byte, and when the pattern has a
+// mandatory literal (":" for Python/Rust, ";" for C — the type-token
+// separator) the line must contain it. On model-heavy sources this rejects
+// brace-only and punctuation lines without ever running RE2.
+func (fs *fieldScanner) lineMayBeField(cleaned string) bool {
+	hasIdent := false
+	for i := 0; i < len(cleaned); i++ {
+		c := cleaned[i]
+		if c == '(' || c == ')' {
+			return false
+		}
+		if !hasIdent && (c == '_' || c == '$' || c >= 0x80 ||
+			(c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+			hasIdent = true
+		}
+	}
+	if !hasIdent {
+		return false
 	}
+	return fs.literal == "" || strings.Contains(cleaned, fs.literal)
+}
 
-	state := StateNormal
+// matchField runs the regex on a line that survived the gate and applies the
+// name and exclude-word checks.
+func (fs *fieldScanner) matchField(cleaned string, lineNo int) (FieldBounds, bool) {
+	matches := fs.regex.FindStringSubmatch(cleaned)
+	if matches == nil || len(matches) < 2 {
+		return FieldBounds{}, false
+	}
+	fieldName := matches[1]
+	if fieldName == "" || fs.exclude[fieldName] {
+		return FieldBounds{}, false
+	}
+	fieldType := ""
+	if len(matches) >= 3 {
+		fieldType = strings.TrimSpace(matches[2])
+	}
+	return FieldBounds{Name: fieldName, Type: fieldType, Line: lineNo}, true
+}
+
+// findFieldsForType finds all fields/members in a type definition
+func (f *StructFinder) findFieldsForType(fieldScan *fieldScanner, lines, cleanedLines []string, typeBounds *TypeBounds, lineOffset int) []FieldBounds {
+	var fields []FieldBounds
+	if fieldScan == nil {
+		return fields // No pattern configured
+	}
 
 	for lineNum := typeBounds.Start - 1 - lineOffset; lineNum < len(lines) && lineNum < typeBounds.End-1-lineOffset; lineNum++ {
 		line := lines[lineNum]
-
-		// Clean line from comments and strings
-		cleaned, newState := f.sanitizer.CleanLine(line, state)
-		state = newState
+		cleaned := cleanedLines[lineNum]
 
 		// Skip empty lines and comments
 		if IsEmptyOrComment(cleaned, f.config.LineComment) {
@@ -356,45 +426,18 @@ func (f *StructFinder) findFieldsForType(lines []string, typeBounds *TypeBounds,
 			}
 		}
 
-		// Find field declarations
-		matches := fieldRegex.FindStringSubmatch(cleaned)
-		if matches != nil && len(matches) >= 2 {
-			fieldName := matches[1]
-			fieldType := ""
-			if len(matches) >= 3 {
-				fieldType = strings.TrimSpace(matches[2])
-			}
-
-			// Skip if field name is empty, looks like a method, or is an excluded word
-			if fieldName != "" && !isLikelyMethod(fieldName, cleaned) && !isExcludedWord(fieldName, f.config.ExcludeWords) {
-				fields = append(fields, FieldBounds{
-					Name: fieldName,
-					Type: fieldType,
-					Line: lineNum + 1 + lineOffset,
-				})
-			}
+		// Cheap shape gate first, regex only on survivors
+		if !fieldScan.lineMayBeField(cleaned) {
+			continue
+		}
+		if fb, ok := fieldScan.matchField(cleaned, lineNum+1+lineOffset); ok {
+			fields = append(fields, fb)
 		}
 	}
 
 	return fields
 }
 
-// isLikelyMethod checks if the declaration looks like a method/function
-func isLikelyMethod(name string, line string) bool {
-	// Functions have parentheses, fields don't
-	return strings.Contains(line, "(") || strings.Contains(line, ")")
-}
-
-// isExcludedWord checks if the name is in the exclude words list
-func isExcludedWord(name string, excludeWords []string) bool {
-	for _, word := range excludeWords {
-		if name == word {
-			return true
-		}
-	}
-	return false
-}
-
 // isRubyBlockEnd checks if line is a block end keyword at the expected indent level
 // Used for Ruby-like languages where 'end' closes class/module at matching indent
 func isRubyBlockEnd(line string, keyword string, expectedIndent int) bool {
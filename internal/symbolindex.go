@@ -0,0 +1,240 @@
+// symbolindex.go - Binary symbol index emitted alongside the shard JSON.
+//
+// The JSON shards must be fully parsed before they can answer any query. The
+// index written here is designed to be memory-mapped instead: a fixed-width
+// record array sorted by symbol name plus a deduplicated string table, so
+// "which file/lines define symbol X" is a binary search over the mapping with
+// no deserialization — startup cost is one mmap and resident memory is
+// whatever the page cache keeps warm.
+//
+// Layout (all integers little-endian):
+//
+//	header (24 bytes):
+//	    magic   [8]byte  "FFIDX\x01\x00\x00"
+//	    count   uint32   number of records
+//	    recOff  uint32   offset of the record array (24)
+//	    strOff  uint32   offset of the string table
+//	    strLen  uint32   length of the string table
+//	records (count × 28 bytes, sorted by name, then path, then start line):
+//	    nameOff, nameLen, pathOff, pathLen, start, end, kind  (uint32 each)
+//	string table: raw bytes, strings deduplicated, no terminators
+package internal
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+)
+
+// SymbolIndexName is the index filename inside a split output directory.
+const SymbolIndexName = "symbols.idx"
+
+var symbolIndexMagic = [8]byte{'F', 'F', 'I', 'D', 'X', 1, 0, 0}
+
+const (
+	symbolIndexHeaderSize = 24
+	symbolIndexRecordSize = 28
+
+	symbolKindFunction = 0
+	symbolKindClass    = 1
+)
+
+// SymbolLocation is one definition site answered by the index.
+type SymbolLocation struct {
+	Name  string
+	Path  string
+	Start int
+	End   int
+	Kind  string // "function" or "class"
+}
+
+// symbolLocationsFromResults flattens directory results into index records.
+func symbolLocationsFromResults(results []DirResult) []SymbolLocation {
+	var locs []SymbolLocation
+	for _, r := range results {
+		for _, fn := range r.Functions {
+			locs = append(locs, SymbolLocation{
+				Name: fn.Name, Path: r.Path, Start: fn.Start, End: fn.End, Kind: "function",
+			})
+		}
+		for _, c := range r.Classes {
+			locs = append(locs, SymbolLocation{
+				Name: c.Name, Path: r.Path, Start: c.Start, End: c.End, Kind: "class",
+			})
+		}
+	}
+	return locs
+}
+
+// WriteSymbolIndex writes the binary index for locs into outDir.
+func WriteSymbolIndex(locs []SymbolLocation, outDir string) error {
+	sorted := make([]SymbolLocation, len(locs))
+	copy(sorted, locs)
+	sort.Slice(sorted, func(i, j int) bool {
+		if sorted[i].Name != sorted[j].Name {
+			return sorted[i].Name < sorted[j].Name
+		}
+		if sorted[i].Path != sorted[j].Path {
+			return sorted[i].Path < sorted[j].Path
+		}
+		return sorted[i].Start < sorted[j].Start
+	})
+
+	// Deduplicated string table: symbol names repeat across files and every
+	// path repeats once per symbol it defines.
+	var strTab bytes.Buffer
+	offsets := make(map[string]uint32)
+	intern := func(s string) (uint32, uint32) {
+		if off, ok := offsets[s]; ok {
+			return off, uint32(len(s))
+		}
+		off := uint32(strTab.Len())
+		offsets[s] = off
+		strTab.WriteString(s)
+		return off, uint32(len(s))
+	}
+
+	records := make([]byte, 0, len(sorted)*symbolIndexRecordSize)
+	var rec [symbolIndexRecordSize]byte
+	for _, loc := range sorted {
+		nameOff, nameLen := intern(loc.Name)
+		pathOff, pathLen := intern(loc.Path)
+		kind := uint32(symbolKindFunction)
+		if loc.Kind == "class" {
+			kind = symbolKindClass
+		}
+		binary.LittleEndian.PutUint32(rec[0:], nameOff)
+		binary.LittleEndian.PutUint32(rec[4:], nameLen)
+		binary.LittleEndian.PutUint32(rec[8:], pathOff)
+		binary.LittleEndian.PutUint32(rec[12:], pathLen)
+		binary.LittleEndian.PutUint32(rec[16:], uint32(loc.Start))
+		binary.LittleEndian.PutUint32(rec[20:], uint32(loc.End))
+		binary.LittleEndian.PutUint32(rec[24:], kind)
+		records = append(records, rec[:]...)
+	}
+
+	var header [symbolIndexHeaderSize]byte
+	copy(header[0:], symbolIndexMagic[:])
+	binary.LittleEndian.PutUint32(header[8:], uint32(len(sorted)))
+	binary.LittleEndian.PutUint32(header[12:], symbolIndexHeaderSize)
+	binary.LittleEndian.PutUint32(header[16:], uint32(symbolIndexHeaderSize+len(records)))
+	binary.LittleEndian.PutUint32(header[20:], uint32(strTab.Len()))
+
+	var out bytes.Buffer
+	out.Grow(symbolIndexHeaderSize + len(records) + strTab.Len())
+	out.Write(header[:])
+	out.Write(records)
+	out.Write(strTab.Bytes())
+
+	indexPath := filepath.Join(outDir, SymbolIndexName)
+	if err := os.WriteFile(indexPath, out.Bytes(), 0644); err != nil {
+		return fmt.Errorf("writing symbol index: %w", err)
+	}
+	return nil
+}
+
+// SymbolIndex is an opened (memory-mapped) index. Lookups read straight from
+// the mapping; nothing is deserialized up front.
+type SymbolIndex struct {
+	data    []byte
+	release func()
+	count   int
+	records []byte
+	strTab  []byte
+}
+
+// OpenSymbolIndex maps the index file at path.
+func OpenSymbolIndex(path string) (*SymbolIndex, error) {
+	data, release, err := mmapFile(path)
+	if err != nil {
+		return nil, err
+	}
+	idx, err := parseSymbolIndex(data)
+	if err != nil {
+		release()
+		return nil, err
+	}
+	idx.release = release
+	return idx, nil
+}
+
+// parseSymbolIndex validates the header and slices out the sections.
+func parseSymbolIndex(data []byte) (*SymbolIndex, error) {
+	if len(data) < symbolIndexHeaderSize || !bytes.Equal(data[:8], symbolIndexMagic[:]) {
+		return nil, fmt.Errorf("not a symbol index (bad magic)")
+	}
+	count := int(binary.LittleEndian.Uint32(data[8:]))
+	recOff := int(binary.LittleEndian.Uint32(data[12:]))
+	strOff := int(binary.LittleEndian.Uint32(data[16:]))
+	strLen := int(binary.LittleEndian.Uint32(data[20:]))
+
+	recEnd := recOff + count*symbolIndexRecordSize
+	if recOff != symbolIndexHeaderSize || recEnd > len(data) ||
+		strOff != recEnd || strOff+strLen > len(data) {
+		return nil, fmt.Errorf("corrupt symbol index (section bounds)")
+	}
+
+	return &SymbolIndex{
+		data:    data,
+		count:   count,
+		records: data[recOff:recEnd],
+		strTab:  data[strOff : strOff+strLen],
+	}, nil
+}
+
+// Close releases the mapping. Records returned earlier stay valid (their
+// strings are copies).
+func (idx *SymbolIndex) Close() {
+	if idx.release != nil {
+		idx.release()
+		idx.release = nil
+	}
+}
+
+// Len returns the number of records in the index.
+func (idx *SymbolIndex) Len() int { return idx.count }
+
+// nameBytes returns record i's name directly from the mapping (no copy).
+func (idx *SymbolIndex) nameBytes(i int) []byte {
+	rec := idx.records[i*symbolIndexRecordSize:]
+	off := binary.LittleEndian.Uint32(rec[0:])
+	length := binary.LittleEndian.Uint32(rec[4:])
+	return idx.strTab[off : off+length]
+}
+
+// Record decodes record i. The returned strings are copies and stay valid
+// after Close.
+func (idx *SymbolIndex) Record(i int) SymbolLocation {
+	rec := idx.records[i*symbolIndexRecordSize:]
+	pathOff := binary.LittleEndian.Uint32(rec[8:])
+	pathLen := binary.LittleEndian.Uint32(rec[12:])
+	kind := "function"
+	if binary.LittleEndian.Uint32(rec[24:]) == symbolKindClass {
+		kind = "class"
+	}
+	return SymbolLocation{
+		Name:  string(idx.nameBytes(i)),
+		Path:  string(idx.strTab[pathOff : pathOff+pathLen]),
+		Start: int(binary.LittleEndian.Uint32(rec[16:])),
+		End:   int(binary.LittleEndian.Uint32(rec[20:])),
+		Kind:  kind,
+	}
+}
+
+// Lookup answers "which file/lines define name" by binary search over the
+// sorted record array. Only the matched records are decoded.
+func (idx *SymbolIndex) Lookup(name string) []SymbolLocation {
+	target := []byte(name)
+	first := sort.Search(idx.count, func(i int) bool {
+		return bytes.Compare(idx.nameBytes(i), target) >= 0
+	})
+
+	var locs []SymbolLocation
+	for i := first; i < idx.count && bytes.Equal(idx.nameBytes(i), target); i++ {
+		locs = append(locs, idx.Record(i))
+	}
+	return locs
+}
@@ -0,0 +1,108 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func symbolIndexTestResults() []DirResult {
+	return []DirResult{
+		{
+			Path: "pkg/a.go",
+			Functions: []FunctionBounds{
+				{Name: "Alpha", Start: 10, End: 20},
+				{Name: "Shared", Start: 30, End: 40},
+			},
+			Classes: []ClassBounds{{Name: "Box", Start: 1, End: 8}},
+		},
+		{
+			Path:      "pkg/b.go",
+			Functions: []FunctionBounds{{Name: "Shared", Start: 5, End: 9}},
+		},
+	}
+}
+
+func TestSymbolIndex_WriteAndLookup(t *testing.T) {
+	outDir := t.TempDir()
+	locs := symbolLocationsFromResults(symbolIndexTestResults())
+	if err := WriteSymbolIndex(locs, outDir); err != nil {
+		t.Fatalf("WriteSymbolIndex() error = %v", err)
+	}
+
+	idx, err := OpenSymbolIndex(filepath.Join(outDir, SymbolIndexName))
+	if err != nil {
+		t.Fatalf("OpenSymbolIndex() error = %v", err)
+	}
+	defer idx.Close()
+
+	if idx.Len() != 4 {
+		t.Errorf("Len() = %d, want 4", idx.Len())
+	}
+
+	// Symbol defined in two files: both records, sorted by path
+	shared := idx.Lookup("Shared")
+	if len(shared) != 2 {
+		t.Fatalf("Lookup(Shared) returned %d records, want 2", len(shared))
+	}
+	if shared[0].Path != "pkg/a.go" || shared[0].Start != 30 || shared[0].End != 40 {
+		t.Errorf("Lookup(Shared)[0] = %+v", shared[0])
+	}
+	if shared[1].Path != "pkg/b.go" || shared[1].Start != 5 {
+		t.Errorf("Lookup(Shared)[1] = %+v", shared[1])
+	}
+
+	// Class kind survives the round trip
+	box := idx.Lookup("Box")
+	if len(box) != 1 || box[0].Kind != "class" || box[0].Start != 1 || box[0].End != 8 {
+		t.Errorf("Lookup(Box) = %+v", box)
+	}
+
+	if got := idx.Lookup("Alpha"); len(got) != 1 || got[0].Kind != "function" {
+		t.Errorf("Lookup(Alpha) = %+v", got)
+	}
+
+	// Missing symbols answer empty, including ones that sort past the end
+	if got := idx.Lookup("zzz_nothing"); len(got) != 0 {
+		t.Errorf("Lookup(zzz_nothing) = %+v, want empty", got)
+	}
+	if got := idx.Lookup("AAA_nothing"); len(got) != 0 {
+		t.Errorf("Lookup(AAA_nothing) = %+v, want empty", got)
+	}
+}
+
+func TestSymbolIndex_RejectsCorruptFile(t *testing.T) {
+	dir := t.TempDir()
+	bad := filepath.Join(dir, SymbolIndexName)
+	if err := os.WriteFile(bad, []byte("this is not an index"), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+	if _, err := OpenSymbolIndex(bad); err == nil {
+		t.Error("OpenSymbolIndex() on garbage should return an error")
+	}
+}
+
+func TestWriteSplitOutput_EmitsSymbolIndex(t *testing.T) {
+	tmpDir := t.TempDir()
+	outDir := filepath.Join(tmpDir, "out")
+	results := []DirResult{
+		{
+			Path:      filepath.Join(tmpDir, "x.go"),
+			Functions: []FunctionBounds{{Name: "FromShard", Start: 3, End: 7}},
+		},
+	}
+
+	if _, err := WriteSplitOutput(results, outDir, tmpDir, "dir"); err != nil {
+		t.Fatalf("WriteSplitOutput() error = %v", err)
+	}
+
+	idx, err := OpenSymbolIndex(filepath.Join(outDir, SymbolIndexName))
+	if err != nil {
+		t.Fatalf("OpenSymbolIndex() error = %v", err)
+	}
+	defer idx.Close()
+
+	if got := idx.Lookup("FromShard"); len(got) != 1 || got[0].Start != 3 {
+		t.Errorf("Lookup(FromShard) = %+v", got)
+	}
+}
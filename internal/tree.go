@@ -175,26 +175,266 @@ func setLastFlags(nodes []*TreeNode) {
 	}
 }
 
-// FormatTree форматирует результат в древовидном формате
+// flatNode — узел плоского дерева. Дети лежат в том же слайсе непрерывным
+// диапазоном [childLo, childHi), поэтому per-node слайсов Children нет, а
+// lines ссылается на FunctionBounds.Lines без копирования.
+type flatNode struct {
+	name    string
+	typ     TreeNodeType
+	start   int
+	end     int
+	depth   int
+	isLast  bool
+	lines   []string
+	childLo int32
+	childHi int32
+}
+
+// FlatTree — плоское представление дерева функций/классов: один backing
+// slice, выделенный одной аллокацией, вместо отдельного *TreeNode на символ.
+// На сгенерированных файлах с десятками тысяч символов это убирает стоимость
+// аллокаций, которая превышала стоимость парсинга. Узлы лежат в BFS-порядке:
+// сначала все корни, затем дети первого корня, и так далее — поэтому дети
+// любого узла образуют непрерывный диапазон индексов.
+type FlatTree struct {
+	nodes   []flatNode
+	rootEnd int32 // корни занимают nodes[0:rootEnd]
+}
+
+// treeEntry — временная запись при построении: функция и индекс её родителя
+// внутри группы (-1 для корня группы).
+type treeEntry struct {
+	fb     FunctionBounds
+	parent int32
+}
+
+// buildFlatTree строит FlatTree с той же структурой, что BuildTree:
+// классы — корни с методами-детьми, вложенные функции прикрепляются к
+// внешней объемлющей функции своей группы. Родитель ищется стеком по
+// отсортированному списку за O(n log n) вместо квадратичного findParent.
+func buildFlatTree(result *FindResult) *FlatTree {
+	// Группы: методы каждого класса и функции верхнего уровня.
+	type group struct {
+		classIdx int // индекс класса-родителя в result.Classes, -1 для top-level
+		entries  []treeEntry
+	}
+
+	var groups []group
+	for ci, class := range result.Classes {
+		var methods []FunctionBounds
+		for _, fn := range result.Functions {
+			if fn.ClassName == class.Name {
+				methods = append(methods, fn)
+			}
+		}
+		groups = append(groups, group{classIdx: ci, entries: groupEntries(methods)})
+	}
+	var topLevel []FunctionBounds
+	for _, fn := range result.Functions {
+		if len(result.Classes) == 0 || fn.ClassName == "" {
+			topLevel = append(topLevel, fn)
+		}
+	}
+	groups = append(groups, group{classIdx: -1, entries: groupEntries(topLevel)})
+
+	total := len(result.Classes)
+	for _, g := range groups {
+		total += len(g.entries)
+	}
+
+	// Арена и выровненная с ней очередь BFS: queued[i] говорит, из какой
+	// группы и какой записи пришёл узел nodes[i] (-1 для узлов-классов).
+	tree := &FlatTree{nodes: make([]flatNode, 0, total)}
+	type source struct{ group, entry int32 }
+	queued := make([]source, 0, total)
+
+	appendEntry := func(g int32, e int32, depth int, isLast bool) {
+		fb := groups[g].entries[e].fb
+		tree.nodes = append(tree.nodes, flatNode{
+			name:   fb.Name,
+			typ:    NodeTypeFunction,
+			start:  fb.Start,
+			end:    fb.End,
+			depth:  depth,
+			isLast: isLast,
+			lines:  fb.Lines,
+		})
+		queued = append(queued, source{group: g, entry: e})
+	}
+
+	// Корни: классы в исходном порядке, затем функции верхнего уровня.
+	for ci, class := range result.Classes {
+		tree.nodes = append(tree.nodes, flatNode{
+			name:  class.Name,
+			typ:   NodeTypeClass,
+			start: class.Start,
+			end:   class.End,
+		})
+		queued = append(queued, source{group: int32(ci), entry: -1})
+	}
+	tg := int32(len(groups) - 1)
+	for e, entry := range groups[tg].entries {
+		if entry.parent == -1 {
+			appendEntry(tg, int32(e), 0, false)
+		}
+	}
+	tree.rootEnd = int32(len(tree.nodes))
+	for i := int32(0); i < tree.rootEnd; i++ {
+		tree.nodes[i].isLast = i == tree.rootEnd-1
+	}
+
+	// BFS: дети каждого узла добавляются подряд, диапазон запоминается.
+	for p := int32(0); p < int32(len(tree.nodes)); p++ {
+		src := queued[p]
+		lo := int32(len(tree.nodes))
+		g := src.group
+		if src.entry == -1 && g >= 0 {
+			// Узел-класс: дети — корни его группы методов.
+			for e, entry := range groups[g].entries {
+				if entry.parent == -1 {
+					appendEntry(g, int32(e), tree.nodes[p].depth+1, false)
+				}
+			}
+		} else if g >= 0 {
+			for e, entry := range groups[g].entries {
+				if entry.parent == src.entry {
+					appendEntry(g, int32(e), tree.nodes[p].depth+1, false)
+				}
+			}
+		}
+		hi := int32(len(tree.nodes))
+		tree.nodes[p].childLo, tree.nodes[p].childHi = lo, hi
+		if hi > lo {
+			tree.nodes[hi-1].isLast = true
+		}
+	}
+	return tree
+}
+
+// groupEntries сортирует функции группы по начальной строке и находит для
+// каждой родителя — внешнюю объемлющую функцию (ту же, что выбирал
+// findParent: первый содержащий интервал в отсортированном порядке).
+func groupEntries(functions []FunctionBounds) []treeEntry {
+	if len(functions) == 0 {
+		return nil
+	}
+	entries := make([]treeEntry, len(functions))
+	for i, fn := range functions {
+		entries[i] = treeEntry{fb: fn, parent: -1}
+	}
+	sortEntriesByStart(entries)
+
+	// Стек объемлющих интервалов; дно стека — внешний объемлющий.
+	var stack []int32
+	for i := range entries {
+		cur := entries[i].fb
+		for len(stack) > 0 && entries[stack[len(stack)-1]].fb.End <= cur.End {
+			stack = stack[:len(stack)-1]
+		}
+		if len(stack) > 0 {
+			outer := entries[stack[0]].fb
+			if outer.Start < cur.Start && outer.End > cur.End {
+				entries[i].parent = stack[0]
+			}
+		}
+		stack = append(stack, int32(i))
+	}
+	return entries
+}
+
+// sortEntriesByStart — стабильная сортировка по Start (вставками: группы
+// почти всегда уже упорядочены по строкам).
+func sortEntriesByStart(entries []treeEntry) {
+	for i := 1; i < len(entries); i++ {
+		for j := i; j > 0 && entries[j-1].fb.Start > entries[j].fb.Start; j-- {
+			entries[j-1], entries[j] = entries[j], entries[j-1]
+		}
+	}
+}
+
+// maxDepth возвращает глубину дерева (1 для плоского списка корней).
+func (t *FlatTree) maxDepth() int {
+	max := 0
+	for i := range t.nodes {
+		if d := t.nodes[i].depth + 1; d > max {
+			max = d
+		}
+	}
+	return max
+}
+
+// FormatTree форматирует результат в древовидном формате. Рендерер читает
+// плоское дерево напрямую, не разворачивая его в связные узлы.
 func FormatTree(result *FindResult, showTypes bool) string {
-	treeNodes := BuildTree(result)
-	if len(treeNodes) == 0 {
+	tree := buildFlatTree(result)
+	if len(tree.nodes) == 0 {
 		return ""
 	}
 
-	// Устанавливаем флаги IsLast
-	setLastFlags(treeNodes)
-
 	var lines []string
-	for _, node := range treeNodes {
-		lines = append(lines, formatNode(node, showTypes, []bool{}))
-		// Рекурсивно добавляем детей
-		lines = append(lines, formatChildren(node.Children, showTypes, []bool{})...)
+	for i := int32(0); i < tree.rootEnd; i++ {
+		lines = append(lines, tree.formatFlatNode(i, showTypes, nil))
+		lines = tree.formatFlatChildren(i, showTypes, nil, lines)
 	}
 
 	return strings.Join(lines, "\n")
 }
 
+// formatFlatChildren рекурсивно форматирует диапазон детей узла parent.
+func (t *FlatTree) formatFlatChildren(parent int32, showTypes bool, ancestorLast []bool, lines []string) []string {
+	node := &t.nodes[parent]
+	for i := node.childLo; i < node.childHi; i++ {
+		childAncestorLast := append(append([]bool{}, ancestorLast...), i == node.childHi-1)
+		lines = append(lines, t.formatFlatNode(i, showTypes, childAncestorLast))
+		lines = t.formatFlatChildren(i, showTypes, childAncestorLast, lines)
+	}
+	return lines
+}
+
+// formatFlatNode форматирует один узел плоского дерева — вывод побайтово
+// совпадает с formatNode по связному дереву.
+func (t *FlatTree) formatFlatNode(i int32, showTypes bool, ancestorLast []bool) string {
+	node := &t.nodes[i]
+	var builder strings.Builder
+
+	// Строим префикс
+	for j := 0; j < len(ancestorLast)-1; j++ {
+		if ancestorLast[j] {
+			builder.WriteString("    ")
+		} else {
+			builder.WriteString("│   ")
+		}
+	}
+
+	// Добавляем ветку
+	if len(ancestorLast) > 0 {
+		if node.isLast {
+			builder.WriteString("└── ")
+		} else {
+			builder.WriteString("├── ")
+		}
+	}
+
+	// Добавляем тип для классов
+	switch node.typ {
+	case NodeTypeClass:
+		builder.WriteString("class ")
+	case NodeTypeFunction:
+		if node.depth > 0 {
+			builder.WriteString("method ")
+		}
+	}
+
+	if showTypes && node.typ == NodeTypeFunction {
+		if signature := extractSignatureFromLines(node.lines); signature != "" {
+			fmt.Fprintf(&builder, "%s (%d-%d)", signature, node.start, node.end)
+			return builder.String()
+		}
+	}
+	fmt.Fprintf(&builder, "%s (%d-%d)", node.name, node.start, node.end)
+	return builder.String()
+}
+
 // formatChildren рекурсивно форматирует детей узла
 func formatChildren(children []*TreeNode, showTypes bool, ancestorLast []bool) []string {
 	var lines []string
@@ -391,10 +631,9 @@ type TreeSummary struct {
 	TotalLines     int `json:"total_lines"`
 }
 
-// TreeToJSON преобразует результат в JSON-дерево
+// TreeToJSON преобразует результат в JSON-дерево. Глубина считается по
+// плоскому дереву (buildFlatTree), без промежуточных связных узлов.
 func TreeToJSON(result *FindResult, showSignature bool) (string, error) {
-	treeNodes := BuildTree(result)
-
 	output := TreeOutput{
 		Functions: []TreeFunctionNode{},
 		Classes:   []TreeClassNode{},
@@ -405,8 +644,6 @@ func TreeToJSON(result *FindResult, showSignature bool) (string, error) {
 		},
 	}
 
-	maxDepth := 0
-
 	// Обрабатываем классы
 	for _, class := range result.Classes {
 		classNode := TreeClassNode{
@@ -451,10 +688,7 @@ func TreeToJSON(result *FindResult, showSignature bool) (string, error) {
 	}
 
 	// Считаем максимальную глубину
-	for _, node := range treeNodes {
-		calcDepth(node, 1, &maxDepth)
-	}
-	output.Summary.MaxDepth = maxDepth
+	output.Summary.MaxDepth = buildFlatTree(result).maxDepth()
 
 	jsonBytes, err := json.MarshalIndent(output, "", "  ")
 	if err != nil {
@@ -2,6 +2,7 @@ package internal
 
 import (
 	"encoding/json"
+	"fmt"
 	"strings"
 	"testing"
 )
@@ -658,3 +659,49 @@ func TestFormatFunctionLine(t *testing.T) {
 		})
 	}
 }
+
+// TestBuildFlatTree_MatchesPointerTree проверяет, что плоское дерево имеет
+// ту же структуру (имена, порядок, глубины, IsLast), что и связное дерево
+// BuildTree, на случае с классом, методами и вложенной функцией.
+func TestBuildFlatTree_MatchesPointerTree(t *testing.T) {
+	result := &FindResult{
+		Functions: []FunctionBounds{
+			{Name: "method2", Start: 20, End: 30, ClassName: "MyClass"},
+			{Name: "method1", Start: 5, End: 15, ClassName: "MyClass"},
+			{Name: "outer", Start: 40, End: 80},
+			{Name: "inner", Start: 50, End: 60},
+		},
+		Classes: []ClassBounds{{Name: "MyClass", Start: 1, End: 35}},
+	}
+
+	var want []string
+	var walkPtr func(nodes []*TreeNode)
+	walkPtr = func(nodes []*TreeNode) {
+		for _, n := range nodes {
+			want = append(want, fmt.Sprintf("%s d=%d last=%v", n.Name, n.Depth, n.IsLast))
+			walkPtr(n.Children)
+		}
+	}
+	walkPtr(BuildTree(result))
+
+	flat := buildFlatTree(result)
+	var got []string
+	var walkFlat func(lo, hi int32)
+	walkFlat = func(lo, hi int32) {
+		for i := lo; i < hi; i++ {
+			n := &flat.nodes[i]
+			got = append(got, fmt.Sprintf("%s d=%d last=%v", n.name, n.depth, n.isLast))
+			walkFlat(n.childLo, n.childHi)
+		}
+	}
+	walkFlat(0, flat.rootEnd)
+
+	if fmt.Sprint(got) != fmt.Sprint(want) {
+		t.Errorf("flat tree = %v\npointer tree = %v", got, want)
+	}
+
+	// И дерево строится одной аллокацией нужного размера.
+	if len(flat.nodes) != cap(flat.nodes) {
+		t.Errorf("arena len %d != cap %d", len(flat.nodes), cap(flat.nodes))
+	}
+}
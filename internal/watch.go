@@ -0,0 +1,152 @@
+// watch.go - Incremental index refresh for serve mode.
+//
+// Without it a warm QueryServer goes stale the moment a file is saved, and
+// the only fix is a client-issued "rescan" that re-parses the whole tree. The
+// watcher keeps a (path → mtime, size) snapshot of the indexed root, polls it
+// on a short interval, and re-runs only the Jobs whose stamp changed through
+// the DirProcessor, patching the in-memory results in place. The stdlib has
+// no filesystem-event API, so this is a poll — but a stat sweep over the tree
+// is the cheap part of a scan (no reads, no parsing), and the interval bounds
+// staleness the same way an event subscription would.
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"sort"
+	"time"
+)
+
+// fileStamp is the change-detection fingerprint for one file.
+type fileStamp struct {
+	modTime time.Time
+	size    int64
+}
+
+// Watch polls the indexed root every interval and patches the in-memory
+// index for files that changed, appeared or disappeared since the last poll.
+// It blocks until stop is closed; run it in its own goroutine alongside
+// Serve. Only changed files are re-parsed.
+func (qs *QueryServer) Watch(interval time.Duration, stop <-chan struct{}) {
+	prev := qs.snapshotStamps()
+
+	ticker := time.NewTicker(interval)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-stop:
+			return
+		case <-ticker.C:
+		}
+
+		cur := qs.snapshotStamps()
+		changed, removed := diffStamps(prev, cur)
+		prev = cur
+
+		if len(changed) == 0 && len(removed) == 0 {
+			continue
+		}
+		qs.applyChanges(changed, removed)
+	}
+}
+
+// snapshotStamps walks the root with the processor's own filters and stats
+// every indexable file. Files that vanish between walk and stat are skipped;
+// the next poll sees them as removed.
+func (qs *QueryServer) snapshotStamps() map[string]fileStamp {
+	stamps := make(map[string]fileStamp)
+	jobs, err := qs.processor.collectFiles(qs.rootPath)
+	if err != nil {
+		return stamps
+	}
+	for _, job := range jobs {
+		info, err := os.Stat(job.Path)
+		if err != nil {
+			continue
+		}
+		stamps[job.Path] = fileStamp{modTime: info.ModTime(), size: info.Size()}
+	}
+	return stamps
+}
+
+// diffStamps returns the paths that are new/modified in cur and the paths
+// present in prev but gone from cur. Both lists are sorted for deterministic
+// processing order.
+func diffStamps(prev, cur map[string]fileStamp) (changed, removed []string) {
+	for path, stamp := range cur {
+		old, ok := prev[path]
+		if !ok || !old.modTime.Equal(stamp.modTime) || old.size != stamp.size {
+			changed = append(changed, path)
+		}
+	}
+	for path := range prev {
+		if _, ok := cur[path]; !ok {
+			removed = append(removed, path)
+		}
+	}
+	sort.Strings(changed)
+	sort.Strings(removed)
+	return changed, removed
+}
+
+// applyChanges re-parses only the changed files and patches the index.
+func (qs *QueryServer) applyChanges(changed, removed []string) {
+	// Re-run just the affected jobs through the worker pool
+	var jobs []Job
+	for _, path := range changed {
+		langConfig := qs.processor.config.GetLanguageByExtension(path)
+		if langConfig == nil {
+			continue
+		}
+		info, err := os.Stat(path)
+		if err != nil {
+			continue
+		}
+		jobs = append(jobs, Job{
+			Path:      path,
+			Extension: filepath.Ext(path),
+			LangKey:   langConfig.LangKey,
+			Size:      info.Size(),
+		})
+	}
+
+	fresh, err := qs.processor.processFilesParallel(jobs)
+	if err != nil {
+		WarnError("watch: reprocessing changed files: %v", err)
+		return
+	}
+
+	qs.mu.Lock()
+	defer qs.mu.Unlock()
+
+	byPath := make(map[string]int, len(qs.results))
+	for i, r := range qs.results {
+		byPath[r.Path] = i
+	}
+
+	for _, r := range fresh {
+		if i, ok := byPath[r.Path]; ok {
+			qs.results[i] = r
+		} else {
+			byPath[r.Path] = len(qs.results)
+			qs.results = append(qs.results, r)
+		}
+	}
+
+	if len(removed) > 0 {
+		gone := make(map[string]bool, len(removed))
+		for _, path := range removed {
+			gone[path] = true
+		}
+		kept := qs.results[:0]
+		for _, r := range qs.results {
+			if !gone[r.Path] {
+				kept = append(kept, r)
+			}
+		}
+		qs.results = kept
+	}
+
+	InfoMessage("watch: %d file(s) reindexed, %d removed", len(jobs), len(removed))
+}
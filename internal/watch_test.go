@@ -0,0 +1,111 @@
+package internal
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+)
+
+func TestDiffStamps(t *testing.T) {
+	t0 := time.Unix(1000, 0)
+	t1 := time.Unix(2000, 0)
+
+	prev := map[string]fileStamp{
+		"same.go":    {modTime: t0, size: 10},
+		"touched.go": {modTime: t0, size: 10},
+		"resized.go": {modTime: t0, size: 10},
+		"gone.go":    {modTime: t0, size: 10},
+	}
+	cur := map[string]fileStamp{
+		"same.go":    {modTime: t0, size: 10},
+		"touched.go": {modTime: t1, size: 10},
+		"resized.go": {modTime: t0, size: 11},
+		"new.go":     {modTime: t1, size: 5},
+	}
+
+	changed, removed := diffStamps(prev, cur)
+	if got, want := fmtStrings(changed), "[new.go resized.go touched.go]"; got != want {
+		t.Errorf("changed = %s, want %s", got, want)
+	}
+	if got, want := fmtStrings(removed), "[gone.go]"; got != want {
+		t.Errorf("removed = %s, want %s", got, want)
+	}
+}
+
+func fmtStrings(s []string) string {
+	out := "["
+	for i, v := range s {
+		if i > 0 {
+			out += " "
+		}
+		out += v
+	}
+	return out + "]"
+}
+
+func TestWatch_AppliesChangesToIndex(t *testing.T) {
+	config, err := LoadConfig()
+	if err != nil {
+		t.Fatalf("LoadConfig() error = %v", err)
+	}
+	dir := t.TempDir()
+	file := filepath.Join(dir, "a.go")
+	if err := os.WriteFile(file, []byte("package p\n\nfunc First() {\n}\n"), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+
+	dp := NewDirProcessor(config, 1, true, false, "all")
+	qs := NewQueryServer(dp, dir)
+	if err := qs.Rescan(); err != nil {
+		t.Fatalf("Rescan() error = %v", err)
+	}
+
+	prev := qs.snapshotStamps()
+	if len(prev) != 1 {
+		t.Fatalf("snapshotStamps() = %d entries, want 1", len(prev))
+	}
+
+	// Rewrite the file and add a second one; the diff should pick up both.
+	if err := os.WriteFile(file, []byte("package p\n\nfunc Second() {\n}\n"), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+	other := filepath.Join(dir, "b.go")
+	if err := os.WriteFile(other, []byte("package p\n\nfunc Third() {\n}\n"), 0644); err != nil {
+		t.Fatalf("WriteFile() error = %v", err)
+	}
+
+	changed, removed := diffStamps(prev, qs.snapshotStamps())
+	if len(changed) != 2 || len(removed) != 0 {
+		t.Fatalf("diffStamps() = %d changed, %d removed; want 2, 0", len(changed), len(removed))
+	}
+	qs.applyChanges(changed, removed)
+
+	names := indexedFuncNames(qs)
+	if names["First"] || !names["Second"] || !names["Third"] {
+		t.Errorf("after change: indexed functions = %v", names)
+	}
+
+	// Deleting a file must drop its results from the index.
+	if err := os.Remove(other); err != nil {
+		t.Fatalf("Remove() error = %v", err)
+	}
+	qs.applyChanges(nil, []string{other})
+
+	names = indexedFuncNames(qs)
+	if names["Third"] || !names["Second"] {
+		t.Errorf("after removal: indexed functions = %v", names)
+	}
+}
+
+func indexedFuncNames(qs *QueryServer) map[string]bool {
+	qs.mu.RLock()
+	defer qs.mu.RUnlock()
+	names := make(map[string]bool)
+	for _, r := range qs.results {
+		for _, fn := range r.Functions {
+			names[fn.Name] = true
+		}
+	}
+	return names
+}